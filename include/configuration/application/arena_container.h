@@ -0,0 +1,111 @@
+#ifndef CONFIGURATION_APPLICATION_ARENA_CONTAINER_H
+#define CONFIGURATION_APPLICATION_ARENA_CONTAINER_H
+
+// STL
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+
+namespace O::Configuration::Application
+{
+	template<class... Data_Modules>
+	class Arena_Container;
+
+	namespace Detail
+	{
+		/**
+		 * @brief Everything an Arena_Container keeps alive: the arena and the Container allocated from it, destroyed before it.
+		 */
+		template<class... Data_Modules>
+		struct Arena_State
+		{
+			explicit Arena_State(std::size_t initial_size) : arena(initial_size) {}
+
+			std::pmr::monotonic_buffer_resource arena;
+			std::optional<Container<Data_Modules...>> container;
+		};
+	} // namespace Detail
+
+	/**
+	 * @brief Alias describing the expected return type of Build_Arena_From_JSON_* functions.
+	 */
+	template<class... Data_Modules>
+	using Expected_Arena_Builder = O::Expected<Arena_Container<Data_Modules...>, Error>;
+
+	/**
+	 * @brief Container owning the monotonic arena its modules were built from.
+	 *
+	 *  @tparam Data_Modules... : the concrete data types for each module.
+	 *
+	 * Modules whose builder accepts a memory resource (see Module::JSON_Builder) allocate their data from the arena, in a few large blocks next to each other.
+	 * Destroying the container releases the whole configuration generation at once instead of freeing every string and vector.
+	 * Moving the container moves a pointer, the modules and the arena stay where they are.
+	 *
+	 * @note Copying a module out of the container allocates the copy from the default resource.
+	 */
+	template<class... Data_Modules>
+	class Arena_Container
+	{
+	public:
+		explicit Arena_Container(std::unique_ptr<Detail::Arena_State<Data_Modules...>> state) noexcept : state(std::move(state)) {}
+
+		Container<Data_Modules...>& operator*() noexcept { return *state->container; }
+		const Container<Data_Modules...>& operator*() const noexcept { return *state->container; }
+		Container<Data_Modules...>* operator->() noexcept { return &*state->container; }
+		const Container<Data_Modules...>* operator->() const noexcept { return &*state->container; }
+
+		/**
+		 * @brief Return the module of type T.
+		 */
+		template<class T>
+		T& Get() { return state->container->template Get<T>(); }
+
+		template<class T>
+		const T& Get() const { return state->container->template Get<T>(); }
+
+		/**
+		 * @brief The arena of the container, for data added to the modules after the build.
+		 */
+		std::pmr::memory_resource* Resource() const noexcept { return &state->arena; }
+
+	private:
+		std::unique_ptr<Detail::Arena_State<Data_Modules...>> state;
+	};
+
+	/**
+	 * @brief Parse an in-memory JSON string into an Arena_Container.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data JSON text to parse.
+	 * @param initial_size Size of the first block of the arena, 0 to use the size of data which usually holds the whole configuration.
+	 * @return Expected_Arena_Builder<Data_Modules...> - the container, or the errors of Build_From_JSON_String.
+	 */
+	template<class... Data_Modules>
+	Expected_Arena_Builder<Data_Modules...> Build_Arena_From_JSON_String(std::string_view data, std::size_t initial_size = 0);
+
+	/**
+	 * @brief Parse a JSON file into an Arena_Container.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @param mode How the file is read, see Read_Mode.
+	 * @param initial_size Size of the first block of the arena, 0 to use the size of the file.
+	 * @return Expected_Arena_Builder<Data_Modules...> - the container, or the errors of Build_From_JSON_File.
+	 */
+	template<class... Data_Modules>
+	Expected_Arena_Builder<Data_Modules...> Build_Arena_From_JSON_File(const std::filesystem::path& path, Read_Mode mode = Read_Mode::STREAM, std::size_t initial_size = 0);
+} // namespace O::Configuration::Application
+
+#include "arena_container.hpp"
+
+#endif //CONFIGURATION_APPLICATION_ARENA_CONTAINER_H
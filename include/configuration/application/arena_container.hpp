@@ -0,0 +1,53 @@
+#ifndef CONFIGURATION_APPLICATION_ARENA_CONTAINER_HPP
+#define CONFIGURATION_APPLICATION_ARENA_CONTAINER_HPP
+
+// STL
+#include <algorithm>
+#include <system_error>
+
+// APPLICATION
+#include "arena_container.h"
+#include "json_builder.h"
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Move a build into a new Arena_Container, the modules were built from the arena of state.
+	 */
+	template<class... Data_Modules>
+	Expected_Arena_Builder<Data_Modules...> Make_Arena_Container(std::unique_ptr<Arena_State<Data_Modules...>> state, Expected_Builder<Data_Modules...> built)
+	{
+		if (!built.Has_Value())
+			return Expected_Arena_Builder<Data_Modules...>::Make_Error(built.Error());
+
+		// move constructed, the modules keep the allocator of the arena
+		state->container.emplace(std::move(built.Value()));
+		return Expected_Arena_Builder<Data_Modules...>::Make_Value(std::move(state));
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Arena_Builder<Data_Modules...> O::Configuration::Application::Build_Arena_From_JSON_String(std::string_view data, std::size_t initial_size)
+{
+	auto state = std::make_unique<Detail::Arena_State<Data_Modules...>>(std::max<std::size_t>(initial_size ? initial_size : data.size(), 1));
+	Expected_Builder<Data_Modules...> built = Build_From_JSON_String<Data_Modules...>(data, &state->arena);
+	return Detail::Make_Arena_Container<Data_Modules...>(std::move(state), std::move(built));
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Arena_Builder<Data_Modules...> O::Configuration::Application::Build_Arena_From_JSON_File(const std::filesystem::path& path, Read_Mode mode, std::size_t initial_size)
+{
+	if (initial_size == 0)
+	{
+		std::error_code ec;
+		initial_size = static_cast<std::size_t>(std::filesystem::file_size(path, ec));
+		if (ec)
+			initial_size = 0;
+	}
+
+	auto state = std::make_unique<Detail::Arena_State<Data_Modules...>>(std::max<std::size_t>(initial_size, 1));
+	Expected_Builder<Data_Modules...> built = Build_From_JSON_File<Data_Modules...>(path, &state->arena, mode);
+	return Detail::Make_Arena_Container<Data_Modules...>(std::move(state), std::move(built));
+}
+
+#endif //CONFIGURATION_APPLICATION_ARENA_CONTAINER_HPP
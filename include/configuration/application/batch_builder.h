@@ -0,0 +1,58 @@
+#ifndef CONFIGURATION_APPLICATION_BATCH_BUILDER_H
+#define CONFIGURATION_APPLICATION_BATCH_BUILDER_H
+
+// STL
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "json_builder.h"
+#include "thread_pool.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Build one Container per file, spreading the files over pool.
+	 *
+	 * The files are shared between at most pool.Size() + 1 tasks, each owning a Parse_Context reused for all the files it builds.
+	 * Every file gets its own result, the error of one file does not stop the others.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the containers.
+	 * @param paths Files to build.
+	 * @param pool Pool running the builds, Thread_Pool::Shared() when the caller has none.
+	 * @param mode How the files are read.
+	 * @return std::vector<Expected_Builder<Data_Modules...>> - one result per path, in the order of paths.
+	 */
+	template<class... Data_Modules>
+	std::vector<Expected_Builder<Data_Modules...>> Build_From_JSON_Files(std::span<const std::filesystem::path> paths, Thread_Pool& pool, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Build one Container per line of newline delimited JSON, spreading the lines over pool.
+	 *
+	 * Lines holding only whitespace are skipped. Lines are built with the same per-task Parse_Context reuse as Build_From_JSON_Files.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the containers.
+	 * @param ndjson Newline delimited JSON text, '\n' or "\r\n" separated.
+	 * @param pool Pool running the builds, Thread_Pool::Shared() when the caller has none.
+	 * @return std::vector<Expected_Builder<Data_Modules...>> - one result per non blank line, in line order.
+	 */
+	template<class... Data_Modules>
+	std::vector<Expected_Builder<Data_Modules...>> Build_From_NDJSON_String(std::string_view ndjson, Thread_Pool& pool);
+
+	/**
+	 * @brief Same as Build_From_NDJSON_String for a file, the lines are parsed in-situ from a private mapping of the file.
+	 *
+	 * @return O::Expected<std::vector<Expected_Builder<Data_Modules...>>, Error> - the per line results, or FILE_OPENING_FAILED when the file cannot be mapped.
+	 */
+	template<class... Data_Modules>
+	O::Expected<std::vector<Expected_Builder<Data_Modules...>>, Error> Build_From_NDJSON_File(const std::filesystem::path& path, Thread_Pool& pool);
+} // namespace O::Configuration::Application
+
+#include "batch_builder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_BATCH_BUILDER_H
@@ -0,0 +1,113 @@
+#ifndef CONFIGURATION_APPLICATION_BATCH_BUILDER_HPP
+#define CONFIGURATION_APPLICATION_BATCH_BUILDER_HPP
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// APPLICATION
+#include "batch_builder.h"
+#include "json_builder.h"
+#include "mapped_file.h"
+#include "parse_context.h"
+#include "thread_pool.h"
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Run build(index, context) for every index below count on pool and return the results in index order.
+	 *
+	 * At most pool.Size() + 1 tasks take the next index from a shared counter, each with its own Parse_Context, so a slow input does not hold back a fixed share of the others.
+	 */
+	template<class Result, class Build>
+	std::vector<Result> Run_Batch(std::size_t count, Thread_Pool& pool, Build&& build)
+	{
+		std::vector<std::optional<Result>> slots(count);
+		std::atomic<std::size_t> next{ 0 };
+
+		const Thread_Pool::Task task = [&]
+			{
+				Parse_Context context;
+				for (std::size_t index = next.fetch_add(1, std::memory_order_relaxed); index < count; index = next.fetch_add(1, std::memory_order_relaxed))
+					slots[index].emplace(build(index, context));
+			};
+		const std::vector<Thread_Pool::Task> tasks(std::min(count, pool.Size() + 1), task);
+		pool.Run(tasks);
+
+		std::vector<Result> results;
+		results.reserve(count);
+		for (std::optional<Result>& slot : slots)
+			results.push_back(std::move(*slot));
+		return results;
+	}
+
+	/**
+	 * @brief Call on_line(begin, size) for every line of text holding something other than whitespace.
+	 */
+	template<class On_Line>
+	void For_Each_NDJSON_Line(std::string_view text, On_Line&& on_line)
+	{
+		std::size_t begin = 0;
+		while (begin < text.size())
+		{
+			std::size_t end = text.find('\n', begin);
+			if (end == std::string_view::npos)
+				end = text.size();
+
+			const std::string_view line = text.substr(begin, end - begin);
+			if (line.find_first_not_of(" \t\r") != std::string_view::npos)
+				on_line(begin, line.size());
+			begin = end + 1;
+		}
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+std::vector<O::Configuration::Application::Expected_Builder<Data_Modules...>> O::Configuration::Application::Build_From_JSON_Files(std::span<const std::filesystem::path> paths, Thread_Pool& pool, Read_Mode mode)
+{
+	return Detail::Run_Batch<Expected_Builder<Data_Modules...>>(paths.size(), pool, [&](std::size_t index, Parse_Context& context)
+		{
+			return Build_From_JSON_File<Data_Modules...>(paths[index], context, mode);
+		});
+}
+
+template<class... Data_Modules>
+std::vector<O::Configuration::Application::Expected_Builder<Data_Modules...>> O::Configuration::Application::Build_From_NDJSON_String(std::string_view ndjson, Thread_Pool& pool)
+{
+	std::vector<std::string_view> lines;
+	Detail::For_Each_NDJSON_Line(ndjson, [&](std::size_t begin, std::size_t size) { lines.push_back(ndjson.substr(begin, size)); });
+
+	return Detail::Run_Batch<Expected_Builder<Data_Modules...>>(lines.size(), pool, [&](std::size_t index, Parse_Context& context)
+		{
+			return Build_From_JSON_String<Data_Modules...>(lines[index], context);
+		});
+}
+
+template<class... Data_Modules>
+O::Expected<std::vector<O::Configuration::Application::Expected_Builder<Data_Modules...>>, O::Configuration::Application::Error> O::Configuration::Application::Build_From_NDJSON_File(const std::filesystem::path& path, Thread_Pool& pool)
+{
+	using Results = std::vector<Expected_Builder<Data_Modules...>>;
+
+	std::optional<Mapped_File> file = Mapped_File::Open(path);
+	if (!file)
+		return O::Expected<Results, Error>::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+	// every line is null terminated in the private mapping so it can be parsed in-situ
+	char* text = file->Data();
+	std::vector<char*> lines;
+	Detail::For_Each_NDJSON_Line(std::string_view(text, file->Size()), [&](std::size_t begin, std::size_t size)
+		{
+			text[begin + size] = '\0';
+			lines.push_back(text + begin);
+		});
+
+	return O::Expected<Results, Error>::Make_Value(Detail::Run_Batch<Expected_Builder<Data_Modules...>>(lines.size(), pool, [&](std::size_t index, Parse_Context& context)
+		{
+			return Detail::Parse_Insitu_And_Build<Expected_Builder<Data_Modules...>>(lines[index], context.Acquire_Document(), Build_From_JSON_Document<Data_Modules...>);
+		}));
+}
+
+#endif //CONFIGURATION_APPLICATION_BATCH_BUILDER_HPP
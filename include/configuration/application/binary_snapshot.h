@@ -0,0 +1,69 @@
+#ifndef CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_H
+#define CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_H
+
+// STL
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+#include "json_writer.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Hash identifying the JSON source of a snapshot, a snapshot is only loaded for the source it was written from.
+	 */
+	std::uint64_t Snapshot_Source_Hash(std::string_view source) noexcept;
+
+	/**
+	 * @brief Write a container to a binary snapshot file.
+	 *
+	 * Every module must provide a binary serializer through `Module::Traits<Data>::Binary`, see Module::Binary_Serializer.
+	 * The file is written next to path then renamed over it, a reader never sees a partially written snapshot.
+	 *
+	 * @tparam Data_Modules module data types in the container.
+	 * @param data the container to save.
+	 * @param path the snapshot path.
+	 * @param source_hash Snapshot_Source_Hash of the JSON the container was built from.
+	 * @return std::optional<Write_Error> - std::nullopt on success, otherwise the error.
+	 */
+	template<class... Data_Modules>
+	std::optional<Write_Error> Write_Binary_Snapshot(const Container<Data_Modules...>& data, const std::filesystem::path& path, std::uint64_t source_hash);
+
+	/**
+	 * @brief Load a container from a binary snapshot file.
+	 *
+	 * The snapshot is rejected when it was written from another source, for another list of modules, by another serializer Version(), on a platform with another layout, or when its payload is truncated or corrupted.
+	 *
+	 * @tparam Data_Modules module data types in the container, in the order used to write the snapshot.
+	 * @param path the snapshot path.
+	 * @param source_hash Snapshot_Source_Hash of the current JSON source.
+	 * @return std::optional<Container<Data_Modules...>> - std::nullopt when the snapshot is missing or cannot be trusted.
+	 */
+	template<class... Data_Modules>
+	std::optional<Container<Data_Modules...>> Read_Binary_Snapshot(const std::filesystem::path& path, std::uint64_t source_hash);
+
+	/**
+	 * @brief Build the application Container from a JSON file, loading it from a binary snapshot when the snapshot matches the file.
+	 *
+	 * The JSON file is mapped and hashed. When snapshot_path holds a valid snapshot of this content the modules are loaded from it without parsing the JSON.
+	 * Otherwise the mapping is parsed in-situ, the modules are built, and the snapshot is rewritten. Failing to write the snapshot does not fail the build.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container, each with a `Module::Traits<Data>::Binary` serializer.
+	 * @param path Path to the JSON file to parse.
+	 * @param snapshot_path Path of the binary snapshot cache.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File_Cached(const std::filesystem::path& path, const std::filesystem::path& snapshot_path);
+
+} // namespace O::Configuration::Application
+
+#include "binary_snapshot.hpp"
+
+#endif //CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_H
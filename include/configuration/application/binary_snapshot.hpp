@@ -0,0 +1,188 @@
+#ifndef CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_HPP
+#define CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_HPP
+
+// STL
+#include <bit>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// APPLICATION
+#include "binary_snapshot.h"
+#include "fingerprint.h"
+#include "key_dispatch.h"
+#include "mapped_file.h"
+#include "output_sink.h"
+
+// MODULE
+#include "configuration/module/binary_serializer.h"
+#include "configuration/module/traits.h"
+
+// UTILS
+#include "utils/tuple_helper.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Fixed size header at the beginning of a snapshot file, followed by payload_size bytes of module data.
+	 */
+	struct Snapshot_Header
+	{
+		static constexpr char MAGIC[8] = { 'O', 'C', 'F', 'G', 'S', 'N', 'A', 'P' };
+		static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+		char magic[8];
+		std::uint32_t format_version;
+		std::uint32_t module_count;
+		std::uint64_t layout_fingerprint;
+		std::uint64_t source_hash;
+		std::uint64_t payload_size;
+		std::uint64_t payload_hash;
+	};
+
+	/**
+	 * @brief Fingerprint of the snapshot layout: module keys and order, serializer versions, data sizes and alignments, and byte order.
+	 */
+	template<class... Data_Modules>
+	constexpr std::uint64_t Snapshot_Layout_Fingerprint() noexcept
+	{
+		std::uint64_t hash = Mix(sizeof...(Data_Modules) + (std::endian::native == std::endian::little ? 0x100 : 0x200) + sizeof(void*) * 0x10000);
+		((hash = Mix(hash ^ Hash_Key(O::Configuration::Module::Traits<Data_Modules>::Binary::Key())),
+			hash = Mix(hash + O::Configuration::Module::Traits<Data_Modules>::Binary::Version()),
+			hash = Mix(hash + sizeof(Data_Modules) * 0x10000 + alignof(Data_Modules))), ...);
+		return hash;
+	}
+
+	/**
+	 * @brief Load the container of a snapshot from its bytes, std::nullopt when they are not a valid snapshot.
+	 */
+	template<class... Data_Modules>
+	std::optional<Container<Data_Modules...>> Load_Binary_Snapshot(std::span<const char> bytes, std::uint64_t source_hash)
+	{
+		Snapshot_Header header;
+		if (bytes.size() < sizeof(header))
+			return std::nullopt;
+		std::memcpy(&header, bytes.data(), sizeof(header));
+		const std::span<const char> payload = bytes.subspan(sizeof(header));
+
+		if (std::memcmp(header.magic, Snapshot_Header::MAGIC, sizeof(header.magic)) != 0
+			|| header.format_version != Snapshot_Header::FORMAT_VERSION
+			|| header.module_count != sizeof...(Data_Modules)
+			|| header.layout_fingerprint != Snapshot_Layout_Fingerprint<Data_Modules...>()
+			|| header.source_hash != source_hash
+			|| header.payload_size != payload.size()
+			|| header.payload_hash != Hash_Bytes(payload))
+			return std::nullopt;
+
+		std::optional<Container<Data_Modules...>> container(std::in_place);
+		O::Configuration::Module::Binary_Input input(payload);
+		bool ok = true;
+
+		O::For_Each_In_Tuple(container->modules, [&](auto& module_part)
+			{
+				using ModuleType = std::decay_t<decltype(module_part)>;
+				using Binary = typename O::Configuration::Module::Traits<ModuleType>::Binary;
+
+				ok = ok && Binary{}.Load(input, module_part);
+			});
+
+		if (!ok || input.Remaining() != 0)
+			return std::nullopt;
+		return container;
+	}
+} // namespace O::Configuration::Application::Detail
+
+inline std::uint64_t O::Configuration::Application::Snapshot_Source_Hash(std::string_view source) noexcept
+{
+	return Detail::Hash_Bytes(std::span<const char>(source.data(), source.size()));
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Write_Binary_Snapshot(const Container<Data_Modules...>& data, const std::filesystem::path& path, std::uint64_t source_hash)
+{
+	std::vector<char> bytes(sizeof(Detail::Snapshot_Header));
+	O::Configuration::Module::Binary_Output output(bytes);
+
+	O::For_Each_In_Tuple(data.modules, [&](const auto& module_part)
+		{
+			using ModuleType = std::decay_t<decltype(module_part)>;
+			using Binary = typename O::Configuration::Module::Traits<ModuleType>::Binary;
+
+			Binary{}.Save(output, module_part);
+		});
+
+	const std::span<const char> payload = std::span<const char>(bytes).subspan(sizeof(Detail::Snapshot_Header));
+	Detail::Snapshot_Header header{};
+	std::memcpy(header.magic, Detail::Snapshot_Header::MAGIC, sizeof(header.magic));
+	header.format_version = Detail::Snapshot_Header::FORMAT_VERSION;
+	header.module_count = sizeof...(Data_Modules);
+	header.layout_fingerprint = Detail::Snapshot_Layout_Fingerprint<Data_Modules...>();
+	header.source_hash = source_hash;
+	header.payload_size = payload.size();
+	header.payload_hash = Detail::Hash_Bytes(payload);
+	std::memcpy(bytes.data(), &header, sizeof(header));
+
+	// the snapshot is only a cache, a torn write after a crash is rejected by the payload hash so it is not synced
+	const std::filesystem::path temporary = Detail::Temporary_Path(path);
+
+	const int fd = Detail::Open_For_Writing(temporary);
+	if (fd < 0)
+		return Write_Error::FILE_OPEN_FAILED;
+
+	const std::optional<Write_Error> error = Fd_Sink(fd).Write(bytes.data(), bytes.size());
+	if (!Detail::Close_File(fd, false) || error)
+	{
+		std::error_code ec;
+		std::filesystem::remove(temporary, ec);
+		return Write_Error::FILE_WRITE_FAILED;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(temporary, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(temporary, ec);
+		return Write_Error::FILE_WRITE_FAILED;
+	}
+	return std::nullopt;
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Container<Data_Modules...>> O::Configuration::Application::Read_Binary_Snapshot(const std::filesystem::path& path, std::uint64_t source_hash)
+{
+	std::optional<Mapped_File> file = Mapped_File::Open(path);
+	if (!file)
+		return std::nullopt;
+	return Detail::Load_Binary_Snapshot<Data_Modules...>(std::span<const char>(file->Data(), file->Size()), source_hash);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File_Cached(const std::filesystem::path& path, const std::filesystem::path& snapshot_path)
+{
+	std::optional<Mapped_File> file = Mapped_File::Open(path);
+	if (!file)
+		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+	// hashed before the in-situ parse modifies the mapping
+	const std::uint64_t source_hash = Snapshot_Source_Hash(std::string_view(file->Data(), file->Size()));
+
+	if (std::optional<Container<Data_Modules...>> snapshot = Read_Binary_Snapshot<Data_Modules...>(snapshot_path, source_hash))
+		return Expected_Builder<Data_Modules...>::Make_Value(std::move(*snapshot));
+
+	rapidjson::Document doc;
+	rapidjson::ParseResult r = doc.ParseInsitu<rapidjson::kParseDefaultFlags>(file->Data());
+	if (!r)
+		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+	Expected_Builder<Data_Modules...> result = Build_From_JSON_Document<Data_Modules...>(doc);
+	if (result.Has_Value())
+		Write_Binary_Snapshot(result.Value(), snapshot_path, source_hash);
+	return result;
+}
+
+#endif //CONFIGURATION_APPLICATION_BINARY_SNAPSHOT_HPP
@@ -0,0 +1,167 @@
+#ifndef CONFIGURATION_APPLICATION_CBOR_H
+#define CONFIGURATION_APPLICATION_CBOR_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+#include "json_writer.h"
+#include "parse_context.h"
+
+// RAPIDJSON
+#include <rapidjson/rapidjson.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief CBOR (RFC 8949) encoder with the interface of rapidjson::Writer.
+	 *
+	 * The module writers are templates over the rapidjson writer they receive: handed a CBOR_Writer, the same To_JSON emits CBOR.
+	 * Objects and arrays are written with indefinite lengths since their size is not known when they start,
+	 * doubles use the 4 byte encoding when it holds them exactly and integers the shortest encoding.
+	 *
+	 * @tparam Output_Stream rapidjson output stream (Put/Flush) receiving the bytes.
+	 */
+	template<class Output_Stream>
+	class CBOR_Writer
+	{
+	public:
+		using Ch = char;
+
+		explicit CBOR_Writer(Output_Stream& os) : os(os) {}
+
+		bool Null();
+		bool Bool(bool b);
+		bool Int(int i);
+		bool Uint(unsigned u);
+		bool Int64(std::int64_t i);
+		bool Uint64(std::uint64_t u);
+		bool Double(double d);
+		bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool String(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool String(const Ch* str);
+		bool String(const std::string& str);
+		bool Key(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool Key(const Ch* str);
+		bool Key(const std::string& str);
+		bool StartObject();
+		bool EndObject(rapidjson::SizeType member_count = 0);
+		bool StartArray();
+		bool EndArray(rapidjson::SizeType element_count = 0);
+
+		void Flush();
+
+	private:
+		Output_Stream& os;
+	};
+
+	/**
+	 * @brief CBOR (RFC 8949) decoder producing the events of a rapidjson::Reader.
+	 *
+	 * Any rapidjson handler receives the item: a rapidjson::Document, a SAX builder or a CBOR_Writer.
+	 * Tags are skipped, undefined is read as null. Byte strings, non text map keys, integers below INT64_MIN and items nested deeper than MAX_DEPTH
+	 * have no JSON equivalent and fail the parse, as do truncated input and bytes after the item.
+	 */
+	class CBOR_Reader
+	{
+	public:
+		static constexpr std::size_t MAX_DEPTH = 512;
+
+		/**
+		 * @param data Bytes of a single CBOR item, they must outlive the reader.
+		 */
+		explicit CBOR_Reader(std::string_view data) noexcept;
+
+		/**
+		 * @brief Send the item to handler, strings are handed with copy set.
+		 *
+		 * @return bool - false when the data is not a single valid item or when a handler call returned false.
+		 */
+		template<class Handler>
+		bool Parse(Handler& handler);
+
+	private:
+		template<class Handler>
+		bool Parse_Item(Handler& handler, std::size_t depth);
+
+		template<class Handler>
+		bool Parse_Text(Handler& handler, std::uint8_t info, bool key);
+
+		bool Read_Byte(std::uint8_t& byte) noexcept;
+		bool Read_Argument(std::uint8_t info, std::uint64_t& value) noexcept;
+		bool Peek_Break() noexcept;
+
+		std::string_view data;
+		std::size_t position = 0;
+		std::string chunks; /**< Indefinite length strings are gathered here. */
+	};
+
+	/**
+	 * @brief Parse an in-memory CBOR document into a fully built Container.
+	 *
+	 * The item is loaded into a rapidjson::Document and handed to the module builders as with Build_From_JSON_String,
+	 * the same Module::Traits work for both formats.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data CBOR bytes to parse.
+	 * @return Expected_Builder<Data_Modules...> - the built Container, or CBOR_PARSING_FAILED, JSON_ROOT_IS_NOT_AN_OBJECT or a module error.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_CBOR_String(std::string_view data);
+
+	/**
+	 * @brief Same as Build_From_CBOR_String, reusing the Document pools of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_CBOR_String(std::string_view data, Parse_Context& context);
+
+	/**
+	 * @brief Parse a CBOR file into a fully built Container, see Build_From_CBOR_String.
+	 *
+	 * The file is memory mapped, FILE_OPENING_FAILED is returned when it cannot be.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_CBOR_File(const std::filesystem::path& path);
+
+	/**
+	 * @brief Same as Build_From_CBOR_File, reusing the Document pools of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_CBOR_File(const std::filesystem::path& path, Parse_Context& context);
+
+	/**
+	 * @brief Serialize a container to CBOR: a map from the module keys to what the module writers produce.
+	 *
+	 * @tparam Data_Modules module data types in the container.
+	 * @param datas The container to serialize.
+	 * @return std::string The CBOR bytes.
+	 */
+	template<class... Data_Modules>
+	std::string Write_As_CBOR_String(const Container<Data_Modules...>& datas);
+
+	/**
+	 * @brief Serialize a container to CBOR into a caller provided string, replacing its content and reusing its capacity.
+	 */
+	template<class... Data_Modules>
+	void Write_As_CBOR_String(const Container<Data_Modules...>& datas, std::string& out);
+
+	/**
+	 * @brief Write a container to a CBOR file, see Write_As_JSON_File for the options.
+	 *
+	 * @return std::optional<Write_Error> - std::nullopt on success, otherwise the error.
+	 */
+	template<class... Data_Modules>
+	std::optional<Write_Error> Write_As_CBOR_File(const Container<Data_Modules...>& datas, const std::filesystem::path& filepath, const File_Write_Options& options = {});
+
+} // namespace O::Configuration::Application
+
+#include "cbor.hpp"
+
+#endif //CONFIGURATION_APPLICATION_CBOR_H
@@ -0,0 +1,534 @@
+#ifndef CONFIGURATION_APPLICATION_CBOR_HPP
+#define CONFIGURATION_APPLICATION_CBOR_HPP
+
+// STL
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// APPLICATION
+#include "cbor.h"
+#include "mapped_file.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// UTILS
+#include "utils/tuple_helper.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief CBOR major types used by the encoder and the decoder.
+	 */
+	enum CBOR_Major : std::uint8_t {
+		CBOR_UNSIGNED = 0,
+		CBOR_NEGATIVE = 1,
+		CBOR_BYTES = 2,
+		CBOR_TEXT = 3,
+		CBOR_ARRAY = 4,
+		CBOR_MAP = 5,
+		CBOR_TAG = 6,
+		CBOR_SIMPLE = 7
+	};
+
+	inline constexpr std::uint8_t CBOR_INDEFINITE = 31;
+	inline constexpr std::uint8_t CBOR_BREAK = 0xFF;
+
+	/**
+	 * @brief Write the head of an item: its major type and argument, in the shortest encoding.
+	 */
+	template<class Output_Stream>
+	void Put_CBOR_Head(Output_Stream& os, std::uint8_t major, std::uint64_t argument)
+	{
+		const char type = static_cast<char>(major << 5);
+		int bytes;
+		if (argument < 24)
+		{
+			os.Put(static_cast<char>(type | static_cast<char>(argument)));
+			return;
+		}
+		else if (argument <= 0xFF)
+		{
+			os.Put(static_cast<char>(type | 24));
+			bytes = 1;
+		}
+		else if (argument <= 0xFFFF)
+		{
+			os.Put(static_cast<char>(type | 25));
+			bytes = 2;
+		}
+		else if (argument <= 0xFFFFFFFF)
+		{
+			os.Put(static_cast<char>(type | 26));
+			bytes = 4;
+		}
+		else
+		{
+			os.Put(static_cast<char>(type | 27));
+			bytes = 8;
+		}
+
+		// network byte order
+		for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+			os.Put(static_cast<char>((argument >> shift) & 0xFF));
+	}
+
+	/**
+	 * @brief Parse data into doc and pass the root to build, CBOR errors are returned as Result errors.
+	 */
+	template<class Result, class Document, class Build>
+	Result Parse_CBOR_And_Build(std::string_view data, Document& doc, Build&& build)
+	{
+		CBOR_Reader reader(data);
+		bool parsed = false;
+		auto generator = [&](auto& handler) { return parsed = reader.Parse(handler); };
+		doc.Populate(generator);
+
+		if (!parsed)
+			return Result::Make_Error(Error{ "", static_cast<int>(CBOR_PARSING_FAILED) });
+
+		return build(static_cast<const rapidjson::Value&>(doc));
+	}
+
+	/**
+	 * @brief Map the file and parse it with Parse_CBOR_And_Build.
+	 */
+	template<class Result, class Document, class Build>
+	Result Parse_CBOR_File_And_Build(const std::filesystem::path& path, Document& doc, Build&& build)
+	{
+		std::optional<Mapped_File> file = Mapped_File::Open(path);
+		if (!file)
+			return Result::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+		// the strings are copied into the Document, the mapping is only read by the parse
+		return Parse_CBOR_And_Build<Result>(std::string_view(file->Data(), file->Size()), doc, std::forward<Build>(build));
+	}
+
+	/**
+	 * @brief Write the root map holding every module of datas into os.
+	 */
+	template<class Output_Stream, class... Data_Modules>
+	void Write_CBOR_Modules(Output_Stream& os, const Container<Data_Modules...>& datas)
+	{
+		// the module count is known, only the module values use indefinite lengths
+		Put_CBOR_Head(os, CBOR_MAP, sizeof...(Data_Modules));
+
+		CBOR_Writer<Output_Stream> writer(os);
+		O::For_Each_In_Tuple(datas.modules, [&](auto const& module_part)
+			{
+				using Module_T = std::decay_t<decltype(module_part)>;
+				using WriterT = typename O::Configuration::Module::Traits<Module_T>::Writer;
+
+				WriterT module_writer;
+				writer.Key(WriterT::Key());
+				module_writer.To_JSON(writer, module_part);
+			});
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Null()
+{
+	os.Put(static_cast<char>(0xF6));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Bool(bool b)
+{
+	os.Put(static_cast<char>(b ? 0xF5 : 0xF4));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Int(int i)
+{
+	return Int64(i);
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Uint(unsigned u)
+{
+	return Uint64(u);
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Int64(std::int64_t i)
+{
+	// a negative integer n is stored as -1 - n, which is ~n in two's complement
+	if (i < 0)
+		Detail::Put_CBOR_Head(os, Detail::CBOR_NEGATIVE, ~static_cast<std::uint64_t>(i));
+	else
+		Detail::Put_CBOR_Head(os, Detail::CBOR_UNSIGNED, static_cast<std::uint64_t>(i));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Uint64(std::uint64_t u)
+{
+	Detail::Put_CBOR_Head(os, Detail::CBOR_UNSIGNED, u);
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Double(double d)
+{
+	// a finite double out of the float range cannot be narrowed, it takes the 8 bytes form
+	const bool float_range = !std::isfinite(d) || std::fabs(d) <= std::numeric_limits<float>::max();
+	if (float_range && (std::isnan(d) || static_cast<double>(static_cast<float>(d)) == d))
+	{
+		const std::uint32_t bits = std::bit_cast<std::uint32_t>(static_cast<float>(d));
+		os.Put(static_cast<char>(0xFA));
+		for (int shift = 24; shift >= 0; shift -= 8)
+			os.Put(static_cast<char>((bits >> shift) & 0xFF));
+	}
+	else
+	{
+		const std::uint64_t bits = std::bit_cast<std::uint64_t>(d);
+		os.Put(static_cast<char>(0xFB));
+		for (int shift = 56; shift >= 0; shift -= 8)
+			os.Put(static_cast<char>((bits >> shift) & 0xFF));
+	}
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::RawNumber(const Ch* str, rapidjson::SizeType length, bool)
+{
+	std::int64_t integer;
+	const std::from_chars_result as_integer = std::from_chars(str, str + length, integer);
+	if (as_integer.ec == std::errc() && as_integer.ptr == str + length)
+		return Int64(integer);
+
+	double number;
+	const std::from_chars_result as_double = std::from_chars(str, str + length, number);
+	if (as_double.ec == std::errc() && as_double.ptr == str + length)
+		return Double(number);
+	return false;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::String(const Ch* str, rapidjson::SizeType length, bool)
+{
+	Detail::Put_CBOR_Head(os, Detail::CBOR_TEXT, length);
+	for (rapidjson::SizeType i = 0; i < length; ++i)
+		os.Put(str[i]);
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::String(const Ch* str)
+{
+	return String(str, static_cast<rapidjson::SizeType>(std::strlen(str)));
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::String(const std::string& str)
+{
+	return String(str.data(), static_cast<rapidjson::SizeType>(str.size()));
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Key(const Ch* str, rapidjson::SizeType length, bool copy)
+{
+	return String(str, length, copy);
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Key(const Ch* str)
+{
+	return String(str);
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::Key(const std::string& str)
+{
+	return String(str);
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::StartObject()
+{
+	os.Put(static_cast<char>((Detail::CBOR_MAP << 5) | Detail::CBOR_INDEFINITE));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::EndObject(rapidjson::SizeType)
+{
+	os.Put(static_cast<char>(Detail::CBOR_BREAK));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::StartArray()
+{
+	os.Put(static_cast<char>((Detail::CBOR_ARRAY << 5) | Detail::CBOR_INDEFINITE));
+	return true;
+}
+
+template<class Output_Stream>
+bool O::Configuration::Application::CBOR_Writer<Output_Stream>::EndArray(rapidjson::SizeType)
+{
+	os.Put(static_cast<char>(Detail::CBOR_BREAK));
+	return true;
+}
+
+template<class Output_Stream>
+void O::Configuration::Application::CBOR_Writer<Output_Stream>::Flush()
+{
+	os.Flush();
+}
+
+inline O::Configuration::Application::CBOR_Reader::CBOR_Reader(std::string_view data) noexcept : data(data)
+{
+}
+
+template<class Handler>
+bool O::Configuration::Application::CBOR_Reader::Parse(Handler& handler)
+{
+	position = 0;
+	return Parse_Item(handler, 0) && position == data.size();
+}
+
+template<class Handler>
+bool O::Configuration::Application::CBOR_Reader::Parse_Item(Handler& handler, std::size_t depth)
+{
+	if (depth > MAX_DEPTH)
+		return false;
+
+	std::uint8_t initial;
+	if (!Read_Byte(initial))
+		return false;
+	const std::uint8_t major = initial >> 5;
+	const std::uint8_t info = initial & 0x1F;
+
+	switch (major)
+	{
+	case Detail::CBOR_UNSIGNED:
+	{
+		std::uint64_t value;
+		if (!Read_Argument(info, value))
+			return false;
+		// the events rapidjson::Reader sends for the same number
+		return value <= std::numeric_limits<unsigned>::max() ? handler.Uint(static_cast<unsigned>(value)) : handler.Uint64(value);
+	}
+	case Detail::CBOR_NEGATIVE:
+	{
+		std::uint64_t value;
+		if (!Read_Argument(info, value) || value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+			return false;
+		const std::int64_t negative = -1 - static_cast<std::int64_t>(value);
+		return negative >= std::numeric_limits<int>::min() ? handler.Int(static_cast<int>(negative)) : handler.Int64(negative);
+	}
+	case Detail::CBOR_TEXT:
+		return Parse_Text(handler, info, false);
+	case Detail::CBOR_ARRAY:
+	case Detail::CBOR_MAP:
+	{
+		const bool map = major == Detail::CBOR_MAP;
+		if (!(map ? handler.StartObject() : handler.StartArray()))
+			return false;
+
+		auto parse_entry = [&]
+			{
+				if (!map)
+					return Parse_Item(handler, depth + 1);
+
+				std::uint8_t key;
+				return Read_Byte(key) && (key >> 5) == Detail::CBOR_TEXT && Parse_Text(handler, key & 0x1F, true) && Parse_Item(handler, depth + 1);
+			};
+
+		rapidjson::SizeType count = 0;
+		if (info == Detail::CBOR_INDEFINITE)
+		{
+			for (; !Peek_Break(); ++count)
+				if (!parse_entry())
+					return false;
+		}
+		else
+		{
+			std::uint64_t size;
+			// every entry takes at least one byte, a larger size is a corrupted head
+			if (!Read_Argument(info, size) || size > data.size() - position)
+				return false;
+			for (; count < size; ++count)
+				if (!parse_entry())
+					return false;
+		}
+		return map ? handler.EndObject(count) : handler.EndArray(count);
+	}
+	case Detail::CBOR_TAG:
+	{
+		std::uint64_t tag;
+		return Read_Argument(info, tag) && Parse_Item(handler, depth + 1);
+	}
+	case Detail::CBOR_SIMPLE:
+		switch (info)
+		{
+		case 20: return handler.Bool(false);
+		case 21: return handler.Bool(true);
+		case 22:
+		case 23: return handler.Null();
+		case 25:
+		{
+			std::uint64_t half;
+			if (!Read_Argument(info, half))
+				return false;
+			const int exponent = static_cast<int>((half >> 10) & 0x1F);
+			const double mantissa = static_cast<double>(half & 0x3FF);
+			double value;
+			if (exponent == 0)
+				value = std::ldexp(mantissa, -24);
+			else if (exponent != 31)
+				value = std::ldexp(mantissa + 1024, exponent - 25);
+			else
+				value = mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+			return handler.Double(half & 0x8000 ? -value : value);
+		}
+		case 26:
+		{
+			std::uint64_t bits;
+			return Read_Argument(info, bits) && handler.Double(std::bit_cast<float>(static_cast<std::uint32_t>(bits)));
+		}
+		case 27:
+		{
+			std::uint64_t bits;
+			return Read_Argument(info, bits) && handler.Double(std::bit_cast<double>(bits));
+		}
+		default:
+			return false;
+		}
+	default:
+		return false;
+	}
+}
+
+template<class Handler>
+bool O::Configuration::Application::CBOR_Reader::Parse_Text(Handler& handler, std::uint8_t info, bool key)
+{
+	const char* text;
+	std::uint64_t size;
+	if (info == Detail::CBOR_INDEFINITE)
+	{
+		// definite length chunks of the same major type up to the break
+		chunks.clear();
+		while (!Peek_Break())
+		{
+			std::uint8_t chunk;
+			std::uint64_t chunk_size;
+			if (!Read_Byte(chunk) || (chunk >> 5) != Detail::CBOR_TEXT || !Read_Argument(chunk & 0x1F, chunk_size) || chunk_size > data.size() - position)
+				return false;
+			chunks.append(data.data() + position, static_cast<std::size_t>(chunk_size));
+			position += static_cast<std::size_t>(chunk_size);
+		}
+		text = chunks.data();
+		size = chunks.size();
+	}
+	else
+	{
+		if (!Read_Argument(info, size) || size > data.size() - position)
+			return false;
+		text = data.data() + position;
+		position += static_cast<std::size_t>(size);
+	}
+
+	if (size > std::numeric_limits<rapidjson::SizeType>::max())
+		return false;
+	const rapidjson::SizeType length = static_cast<rapidjson::SizeType>(size);
+	return key ? handler.Key(text, length, true) : handler.String(text, length, true);
+}
+
+inline bool O::Configuration::Application::CBOR_Reader::Read_Byte(std::uint8_t& byte) noexcept
+{
+	if (position == data.size())
+		return false;
+	byte = static_cast<std::uint8_t>(data[position++]);
+	return true;
+}
+
+inline bool O::Configuration::Application::CBOR_Reader::Read_Argument(std::uint8_t info, std::uint64_t& value) noexcept
+{
+	if (info < 24)
+	{
+		value = info;
+		return true;
+	}
+	if (info > 27)
+		return false;
+
+	const std::size_t bytes = std::size_t(1) << (info - 24);
+	if (bytes > data.size() - position)
+		return false;
+
+	value = 0;
+	for (std::size_t i = 0; i < bytes; ++i)
+		value = (value << 8) | static_cast<std::uint8_t>(data[position++]);
+	return true;
+}
+
+inline bool O::Configuration::Application::CBOR_Reader::Peek_Break() noexcept
+{
+	if (position == data.size() || static_cast<std::uint8_t>(data[position]) != Detail::CBOR_BREAK)
+		return false;
+	++position;
+	return true;
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_CBOR_String(std::string_view data)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_CBOR_And_Build<Expected_Builder<Data_Modules...>>(data, doc, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_CBOR_String(std::string_view data, Parse_Context& context)
+{
+	return Detail::Parse_CBOR_And_Build<Expected_Builder<Data_Modules...>>(data, context.Acquire_Document(), Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_CBOR_File(const std::filesystem::path& path)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_CBOR_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_CBOR_File(const std::filesystem::path& path, Parse_Context& context)
+{
+	return Detail::Parse_CBOR_File_And_Build<Expected_Builder<Data_Modules...>>(path, context.Acquire_Document(), Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules>
+std::string O::Configuration::Application::Write_As_CBOR_String(const Container<Data_Modules...>& datas)
+{
+	std::string cbor;
+	Write_As_CBOR_String(datas, cbor);
+	return cbor;
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Write_As_CBOR_String(const Container<Data_Modules...>& datas, std::string& out)
+{
+	out.clear();
+	Detail::Chars_Sink<std::string> os(out);
+	Detail::Write_CBOR_Modules(os, datas);
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Write_As_CBOR_File(const Container<Data_Modules...>& datas, const std::filesystem::path& filepath, const File_Write_Options& options)
+{
+	return Detail::Write_File(filepath, options, [&](auto& os) { Detail::Write_CBOR_Modules(os, datas); });
+}
+
+#endif //CONFIGURATION_APPLICATION_CBOR_HPP
@@ -0,0 +1,72 @@
+#ifndef CONFIGURATION_APPLICATION_CONSTANT_BUILDER_H
+#define CONFIGURATION_APPLICATION_CONSTANT_BUILDER_H
+
+// STL
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+
+// MODULE
+#include "configuration/module/constant_value.h"
+#include "configuration/module/traits.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief String literal usable as a template argument, holds the JSON of Build_From_JSON_Constant.
+	 */
+	template<std::size_t N>
+	struct Fixed_String
+	{
+		static constexpr std::size_t SIZE = N - 1;
+
+		constexpr Fixed_String(const char (&text)[N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+				chars[i] = text[i];
+		}
+
+		constexpr std::string_view View() const noexcept
+		{
+			return std::string_view(chars, SIZE);
+		}
+
+		char chars[N] = {};
+	};
+
+	/**
+	 * @brief Build a Container from a JSON literal during compilation.
+	 *
+	 * The literal is parsed and every module is loaded by the static constexpr Load_Constant of its builder,
+	 * JSON_Fields_Builder provides it when all its Field_Type do. The checks are the ones of Build_From_JSON_String:
+	 * an invalid literal, a root that is not an object or a module error is a compile error, Validate_JSON_Constant tells which.
+	 * Modules missing from the literal are value initialized. std::string_view members point into static storage.
+	 *
+	 * @code
+	 * static constexpr auto DEFAULTS = Build_From_JSON_Constant<R"({ "numeric": { "tolerance": 0.5 } })", Numeric>();
+	 * @endcode
+	 *
+	 * @tparam JSON         The JSON literal.
+	 * @tparam Data_Modules List of module data types to include in the container, they must be literal types.
+	 * @return Container<Data_Modules...> - the built container.
+	 */
+	template<Fixed_String JSON, class... Data_Modules>
+	consteval Container<Data_Modules...> Build_From_JSON_Constant();
+
+	/**
+	 * @brief The error Build_From_JSON_Constant would stop on, for static_assert.
+	 *
+	 * @return std::optional<Error> - std::nullopt when the literal builds, otherwise the same error as Build_From_JSON_String.
+	 */
+	template<Fixed_String JSON, class... Data_Modules>
+	constexpr std::optional<Error> Validate_JSON_Constant();
+
+} // namespace O::Configuration::Application
+
+#include "constant_builder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_CONSTANT_BUILDER_H
@@ -0,0 +1,91 @@
+#ifndef CONFIGURATION_APPLICATION_CONSTANT_BUILDER_HPP
+#define CONFIGURATION_APPLICATION_CONSTANT_BUILDER_HPP
+
+// STL
+#include <algorithm>
+#include <tuple>
+
+// APPLICATION
+#include "constant_builder.h"
+
+namespace O::Configuration::Application::Detail
+{
+	template<Fixed_String JSON>
+	inline constexpr auto CONSTANT_DOCUMENT = O::Configuration::Module::Constant_Document<std::max<std::size_t>(decltype(JSON)::SIZE, 1)>::Parse(JSON.View());
+
+	// the characters alone end up in the program, the nodes are only read during compilation
+	template<Fixed_String JSON>
+	inline constexpr auto CONSTANT_CHARS = CONSTANT_DOCUMENT<JSON>.chars;
+
+	template<class... Data_Modules>
+	struct Constant_Build
+	{
+		Container<Data_Modules...> container{};
+		std::optional<Error> error;
+	};
+
+	template<class ModuleType>
+	constexpr bool Load_Constant_Module(const O::Configuration::Module::Constant_Value& root, ModuleType& module_part, std::optional<Error>& error)
+	{
+		using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+		static_assert(requires(const O::Configuration::Module::Constant_Value& v, ModuleType& data) { Builder::Load_Constant(v, data); },
+			"The builder of the module must define static constexpr Load_Constant to be built at compile time.");
+
+		const std::optional<O::Configuration::Module::Constant_Value> value = root.Find(Builder::Key());
+		if (!value)
+			return true;
+
+		if (auto module_error = Builder::Load_Constant(*value, module_part))
+		{
+			error = Error{ Builder::Key(), static_cast<int>(*module_error) };
+			return false;
+		}
+		return true;
+	}
+
+	template<Fixed_String JSON, class... Data_Modules>
+	constexpr Constant_Build<Data_Modules...> Build_Constant()
+	{
+		constexpr auto& document = CONSTANT_DOCUMENT<JSON>;
+		Constant_Build<Data_Modules...> build;
+
+		if (!document.valid)
+		{
+			build.error = Error{ "", JSON_PARSING_FAILED };
+			return build;
+		}
+
+		const O::Configuration::Module::Constant_Value root = document.Root(CONSTANT_CHARS<JSON>.data());
+		if (!root.Is_Object())
+		{
+			build.error = Error{ "", JSON_ROOT_IS_NOT_AN_OBJECT };
+			return build;
+		}
+
+		std::apply([&](auto&... module_part)
+			{
+				(void)(Load_Constant_Module(root, module_part, build.error) && ...);
+			}, build.container.modules);
+		return build;
+	}
+
+	// not constexpr: reaching it during constant evaluation turns the invalid configuration into a compile error
+	inline void Embedded_Configuration_Is_Invalid(std::string_view, int) {}
+}
+
+template<O::Configuration::Application::Fixed_String JSON, class... Data_Modules>
+consteval O::Configuration::Application::Container<Data_Modules...> O::Configuration::Application::Build_From_JSON_Constant()
+{
+	Detail::Constant_Build<Data_Modules...> build = Detail::Build_Constant<JSON, Data_Modules...>();
+	if (build.error)
+		Detail::Embedded_Configuration_Is_Invalid(build.error->module_name, build.error->error_id);
+	return build.container;
+}
+
+template<O::Configuration::Application::Fixed_String JSON, class... Data_Modules>
+constexpr std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_Constant()
+{
+	return Detail::Build_Constant<JSON, Data_Modules...>().error;
+}
+
+#endif //CONFIGURATION_APPLICATION_CONSTANT_BUILDER_HPP
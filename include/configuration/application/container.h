@@ -28,7 +28,19 @@ namespace O::Configuration::Application
 		 * @note This uses std::get<T> and therefore will fail to compile if T is not part of DataModules...
 		 */
 		template<class T>
-		T& Get()
+		constexpr T& Get()
+		{
+			return std::get<T>(modules);
+		}
+
+		/**
+		 * @brief Return a const reference to the module of type T.
+		 *
+		 * @tparam T The module data type stored in the tuple.
+		 * @return const T& Reference to the module within the tuple.
+		 */
+		template<class T>
+		constexpr const T& Get() const
 		{
 			return std::get<T>(modules);
 		}
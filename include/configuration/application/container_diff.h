@@ -0,0 +1,47 @@
+#ifndef CONFIGURATION_APPLICATION_CONTAINER_DIFF_H
+#define CONFIGURATION_APPLICATION_CONTAINER_DIFF_H
+
+// STL
+#include <optional>
+#include <string>
+#include <string_view>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Write the modules of to that differ from from as a JSON object, keyed like a configuration file.
+	 *
+	 * The diff is a per-module replace list: a configuration holding only the changed modules, each written whole by its Writer.
+	 * Modules that are equality comparable are compared with operator==, the others by comparing their JSON.
+	 * Identical containers give "{}".
+	 *
+	 * @tparam Data_Modules List of module data types of the containers.
+	 * @param from Container the receiver currently holds.
+	 * @param to Container the receiver should hold.
+	 * @return std::string - the diff, its size only depends on the changed modules.
+	 */
+	template<class... Data_Modules>
+	std::string Diff_As_JSON_String(const Container<Data_Modules...>& from, const Container<Data_Modules...>& to);
+
+	/**
+	 * @brief Replace the modules of target present in diff, the other modules are not touched.
+	 *
+	 * The changed modules are built first and moved into target only when all of them built, so target is unchanged on error.
+	 * Keys that match no module are ignored, as with Build_From_JSON_*.
+	 *
+	 * @tparam Data_Modules List of module data types of the container.
+	 * @param target Container to update.
+	 * @param diff Output of Diff_As_JSON_String, or any configuration holding a subset of the modules.
+	 * @return std::optional<Error> - std::nullopt on success, otherwise the parse error or the first module error in module order.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Apply_JSON_Diff(Container<Data_Modules...>& target, std::string_view diff);
+} // namespace O::Configuration::Application
+
+#include "container_diff.hpp"
+
+#endif //CONFIGURATION_APPLICATION_CONTAINER_DIFF_H
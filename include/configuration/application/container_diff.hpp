@@ -0,0 +1,132 @@
+#ifndef CONFIGURATION_APPLICATION_CONTAINER_DIFF_HPP
+#define CONFIGURATION_APPLICATION_CONTAINER_DIFF_HPP
+
+// STL
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// APPLICATION
+#include "container.h"
+#include "container_diff.h"
+#include "json_builder.h"
+#include "json_writer.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Whether two values of a module differ, compared with operator== when available or through the JSON of its Writer.
+	 *
+	 * from_json and to_json are scratch strings reused across modules.
+	 */
+	template<class Data>
+	bool Module_Changed(const Data& from, const Data& to, std::string& from_json, std::string& to_json)
+	{
+		if constexpr (std::equality_comparable<Data>)
+			return !(from == to);
+		else
+		{
+			using Writer = typename O::Configuration::Module::Traits<Data>::Writer;
+
+			auto write = [](const Data& data, std::string& json)
+				{
+					json.clear();
+					Chars_Sink<std::string> os(json);
+					rapidjson::Writer<Chars_Sink<std::string>> writer(os);
+					Writer{}.To_JSON(writer, data);
+				};
+			write(from, from_json);
+			write(to, to_json);
+			return from_json != to_json;
+		}
+	}
+
+	/**
+	 * @brief Build the modules present in diff into modules, stopping at the first error in module order.
+	 */
+	template<class... Data_Modules, std::size_t... I>
+	std::optional<Error> Build_Diff_Modules(const rapidjson::Value& diff, std::tuple<std::optional<Data_Modules>...>& modules, std::index_sequence<I...>)
+	{
+		const auto members = Find_Module_Members<Data_Modules...>(diff);
+
+		std::optional<Error> error;
+		auto build = [&]<std::size_t J>(std::integral_constant<std::size_t, J>)
+			{
+				using Data = std::tuple_element_t<J, std::tuple<Data_Modules...>>;
+				using Builder = typename O::Configuration::Module::Traits<Data>::Builder;
+
+				if (error || members[J] == diff.MemberEnd())
+					return;
+
+				Builder builder;
+				if (auto opt = builder.Load_From_JSON(members[J]->value))
+					error = Error{ Builder::Key(), static_cast<int>(*opt) };
+				else
+					std::get<J>(modules).emplace(std::move(*builder));
+			};
+		(build(std::integral_constant<std::size_t, I>{}), ...);
+		return error;
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+std::string O::Configuration::Application::Diff_As_JSON_String(const Container<Data_Modules...>& from, const Container<Data_Modules...>& to)
+{
+	std::string diff;
+	std::string from_json;
+	std::string to_json;
+
+	Detail::Chars_Sink<std::string> os(diff);
+	rapidjson::Writer<Detail::Chars_Sink<std::string>> writer(os);
+	writer.StartObject();
+
+	auto write_changed = [&](const auto& from_module, const auto& to_module)
+		{
+			using Data = std::decay_t<decltype(to_module)>;
+			using Writer = typename O::Configuration::Module::Traits<Data>::Writer;
+
+			if (!Detail::Module_Changed(from_module, to_module, from_json, to_json))
+				return;
+			writer.Key(Writer::Key());
+			Writer{}.To_JSON(writer, to_module);
+		};
+	(write_changed(from.template Get<Data_Modules>(), to.template Get<Data_Modules>()), ...);
+
+	writer.EndObject();
+	return diff;
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Apply_JSON_Diff(Container<Data_Modules...>& target, std::string_view diff)
+{
+	rapidjson::Document doc;
+	rapidjson::ParseResult r = doc.Parse<rapidjson::kParseDefaultFlags>(diff.data(), static_cast<rapidjson::SizeType>(diff.size()));
+	if (!r)
+		return Error{ "", static_cast<int>(JSON_PARSING_FAILED) };
+	if (!doc.IsObject())
+		return Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) };
+
+	std::tuple<std::optional<Data_Modules>...> modules;
+	if (std::optional<Error> error = Detail::Build_Diff_Modules<Data_Modules...>(doc, modules, std::index_sequence_for<Data_Modules...>{}))
+		return error;
+
+	auto replace = [](auto& module, auto& built)
+		{
+			if (built)
+				module = std::move(*built);
+		};
+	(replace(target.template Get<Data_Modules>(), std::get<std::optional<Data_Modules>>(modules)), ...);
+	return std::nullopt;
+}
+
+#endif //CONFIGURATION_APPLICATION_CONTAINER_DIFF_HPP
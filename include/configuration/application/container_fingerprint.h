@@ -0,0 +1,120 @@
+#ifndef CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_H
+#define CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// APPLICATION
+#include "container.h"
+#include "fingerprint.h"
+
+// RAPIDJSON
+#include <rapidjson/rapidjson.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Hasher with the interface of rapidjson::Writer, turning the events of a module writer into a canonical Digest.
+	 *
+	 * The value is hashed, not its text:
+	 * - the members of an object are combined regardless of their order,
+	 * - an integer has the same digest whichever of Int, Uint, Int64 or Uint64 wrote it,
+	 * - doubles are hashed by value, -0.0 as 0.0 and every NaN alike.
+	 * Arrays keep their order, and strings, keys and numbers written as RawNumber are hashed byte for byte.
+	 * The events are tagged and mixed as in Detail::Fingerprint_Handler, the ordered fingerprint of a JSON value.
+	 */
+	class Fingerprint_Writer
+	{
+	public:
+		using Ch = char;
+
+		Fingerprint_Writer();
+
+		bool Null();
+		bool Bool(bool b);
+		bool Int(int i);
+		bool Uint(unsigned u);
+		bool Int64(std::int64_t i);
+		bool Uint64(std::uint64_t u);
+		bool Double(double d);
+		bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool String(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool String(const Ch* str);
+		bool String(const std::string& str);
+		bool Key(const Ch* str, rapidjson::SizeType length, bool copy = false);
+		bool Key(const Ch* str);
+		bool Key(const std::string& str);
+		bool StartObject();
+		bool EndObject(rapidjson::SizeType member_count = 0);
+		bool StartArray();
+		bool EndArray(rapidjson::SizeType element_count = 0);
+
+		/**
+		 * @brief Digest of the value written since the construction or the last Reset.
+		 */
+		Digest Result() const noexcept;
+
+		/**
+		 * @brief Start a new value, the nesting buffer is kept.
+		 */
+		void Reset() noexcept;
+
+	private:
+		struct Frame
+		{
+			bool object;
+			Detail::Hash_State state; // elements of an array, current member of an object
+			Digest members = {};      // sum of the member digests of an object
+			std::uint64_t count = 0;
+		};
+
+		Detail::Hash_State& Current() noexcept;
+		bool Value_Written() noexcept;
+		bool Scalar(Detail::Value_Tag tag, std::uint64_t word);
+		bool Text(Detail::Value_Tag tag, const Ch* str, std::size_t length);
+		bool End_Container(Detail::Value_Tag tag, Digest digest);
+
+		Detail::Hash_State root;
+		std::vector<Frame> frames;
+	};
+
+	/**
+	 * @brief Fingerprint of a module, hashed from the events of its Traits::Hasher when it has one and of its Traits::Writer otherwise.
+	 *
+	 * No text is produced. Two modules written as the same JSON value, whatever the key order and number formatting, share the fingerprint.
+	 * A Hasher only changes the fingerprints, it is never used by operator==.
+	 *
+	 * @tparam Data Module data type with a Module::Traits specialization.
+	 */
+	template<class Data>
+	Digest Module_Fingerprint(const Data& data);
+
+	/**
+	 * @brief Fingerprint of a Container, combining the key and fingerprint of each module in module order.
+	 *
+	 * Nodes compare their configuration by exchanging the 16 bytes of the Digest.
+	 */
+	template<class... Data_Modules>
+	Digest Fingerprint(const Container<Data_Modules...>& container);
+
+	/**
+	 * @brief Compare two Containers module by module.
+	 *
+	 * Modules with an operator== are compared with it. The others are compared through the events of their Writer, exactly: member order included,
+	 * doubles compared as by ==, so -0.0 equals 0.0 and a NaN equals nothing. A Hasher is not used, fields it leaves out still count.
+	 *
+	 * A Container holding a NaN is therefore not equal to itself.
+	 *
+	 * @note Equal fingerprints do not make equal Containers, compare Fingerprint() results to compare canonical values.
+	 * Callers holding cached Digests of both sides should compare those first: different fingerprints mean different Containers.
+	 */
+	template<class... Data_Modules>
+	bool operator==(const Container<Data_Modules...>& left, const Container<Data_Modules...>& right);
+} // namespace O::Configuration::Application
+
+#include "container_fingerprint.hpp"
+
+#endif //CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_H
@@ -0,0 +1,346 @@
+#ifndef CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_HPP
+#define CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_HPP
+
+// STL
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+// APPLICATION
+#include "container.h"
+#include "container_fingerprint.h"
+#include "fingerprint.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+inline O::Configuration::Application::Fingerprint_Writer::Fingerprint_Writer()
+{
+	frames.reserve(16);
+}
+
+inline O::Configuration::Application::Detail::Hash_State& O::Configuration::Application::Fingerprint_Writer::Current() noexcept
+{
+	return frames.empty() ? root : frames.back().state;
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Value_Written() noexcept
+{
+	if (frames.empty())
+		return true;
+
+	Frame& frame = frames.back();
+	if (frame.object)
+	{
+		// the member digests are summed so the member order does not matter
+		const Digest member = frame.state.Finish();
+		frame.members.low += member.low;
+		frame.members.high += member.high;
+	}
+	++frame.count;
+	return true;
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Scalar(Detail::Value_Tag tag, std::uint64_t word)
+{
+	Detail::Hash_State& state = Current();
+	state.Feed_Tag(tag);
+	state.Feed(word);
+	return Value_Written();
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Text(Detail::Value_Tag tag, const Ch* str, std::size_t length)
+{
+	Detail::Hash_State& state = Current();
+	state.Feed_Tag(tag);
+	state.Feed_Bytes(str, length);
+	return Value_Written();
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::End_Container(Detail::Value_Tag tag, Digest digest)
+{
+	Detail::Hash_State& state = Current();
+	state.Feed_Tag(tag);
+	state.Feed(digest.low);
+	state.Feed(digest.high);
+	return Value_Written();
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Null()
+{
+	return Scalar(Detail::Value_Tag::NULL_VALUE, 0);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Bool(bool b)
+{
+	return Scalar(b ? Detail::Value_Tag::TRUE_VALUE : Detail::Value_Tag::FALSE_VALUE, 0);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Int(int i)
+{
+	return Int64(i);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Uint(unsigned u)
+{
+	return Uint64(u);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Int64(std::int64_t i)
+{
+	return Scalar(Detail::Value_Tag::INT, static_cast<std::uint64_t>(i));
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Uint64(std::uint64_t u)
+{
+	// an unsigned that fits a signed integer hashes as one
+	if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+		return Int64(static_cast<std::int64_t>(u));
+	return Scalar(Detail::Value_Tag::UINT, u);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Double(double d)
+{
+	if (d == 0.0)
+		d = 0.0;
+	else if (std::isnan(d))
+		d = std::numeric_limits<double>::quiet_NaN();
+	return Scalar(Detail::Value_Tag::DOUBLE, std::bit_cast<std::uint64_t>(d));
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::RawNumber(const Ch* str, rapidjson::SizeType length, bool)
+{
+	return Text(Detail::Value_Tag::RAW_NUMBER, str, length);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::String(const Ch* str, rapidjson::SizeType length, bool)
+{
+	return Text(Detail::Value_Tag::STRING, str, length);
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::String(const Ch* str)
+{
+	return Text(Detail::Value_Tag::STRING, str, std::strlen(str));
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::String(const std::string& str)
+{
+	return Text(Detail::Value_Tag::STRING, str.data(), str.size());
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Key(const Ch* str, rapidjson::SizeType length, bool)
+{
+	// a member is hashed on its own, from its key to the end of its value
+	Detail::Hash_State& state = frames.back().state;
+	state = Detail::Hash_State{};
+	state.Feed_Tag(Detail::Value_Tag::KEY);
+	state.Feed_Bytes(str, length);
+	return true;
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Key(const Ch* str)
+{
+	return Key(str, static_cast<rapidjson::SizeType>(std::strlen(str)));
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::Key(const std::string& str)
+{
+	return Key(str.data(), static_cast<rapidjson::SizeType>(str.size()));
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::StartObject()
+{
+	frames.push_back(Frame{ true, Detail::Hash_State{}, Digest{}, 0 });
+	return true;
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::EndObject(rapidjson::SizeType)
+{
+	const Frame frame = frames.back();
+	frames.pop_back();
+
+	Detail::Hash_State state;
+	state.Feed(frame.count);
+	state.Feed(frame.members.low);
+	state.Feed(frame.members.high);
+	return End_Container(Detail::Value_Tag::END_OBJECT, state.Finish());
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::StartArray()
+{
+	frames.push_back(Frame{ false, Detail::Hash_State{}, Digest{}, 0 });
+	return true;
+}
+
+inline bool O::Configuration::Application::Fingerprint_Writer::EndArray(rapidjson::SizeType)
+{
+	Frame frame = frames.back();
+	frames.pop_back();
+
+	frame.state.Feed(frame.count);
+	return End_Container(Detail::Value_Tag::END_ARRAY, frame.state.Finish());
+}
+
+inline O::Configuration::Application::Digest O::Configuration::Application::Fingerprint_Writer::Result() const noexcept
+{
+	return root.Finish();
+}
+
+inline void O::Configuration::Application::Fingerprint_Writer::Reset() noexcept
+{
+	root = Detail::Hash_State{};
+	frames.clear();
+}
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Write data into writer through the Hasher of the module when it has one, its Writer otherwise.
+	 */
+	template<class Data>
+	void Write_Fingerprint(Fingerprint_Writer& writer, const Data& data)
+	{
+		using Traits = O::Configuration::Module::Traits<Data>;
+
+		if constexpr (requires { typename Traits::Hasher; })
+			typename Traits::Hasher{}.Hash(writer, data);
+		else
+			typename Traits::Writer{}.To_JSON(writer, data);
+	}
+
+	/**
+	 * @brief Handler with the interface of rapidjson::Writer recording the events of a module writer, to compare two modules exactly without text.
+	 *
+	 * Doubles are recorded as == compares them: -0.0 as 0.0, and a log holding a NaN equals no log.
+	 */
+	class Event_Log
+	{
+	public:
+		using Ch = char;
+
+		bool Null() { return Event(Value_Tag::NULL_VALUE); }
+		bool Bool(bool b) { return Event(b ? Value_Tag::TRUE_VALUE : Value_Tag::FALSE_VALUE); }
+		bool Int(int i) { return Int64(i); }
+		bool Uint(unsigned u) { return Uint64(u); }
+		bool Int64(std::int64_t i) { return Event(Value_Tag::INT, static_cast<std::uint64_t>(i)); }
+		bool Uint64(std::uint64_t u) { return Event(Value_Tag::UINT, u); }
+		bool Double(double d)
+		{
+			has_nan |= std::isnan(d);
+			return Event(Value_Tag::DOUBLE, std::bit_cast<std::uint64_t>(d == 0.0 ? 0.0 : d));
+		}
+		bool RawNumber(const Ch* str, rapidjson::SizeType length, bool = false) { return Text(Value_Tag::RAW_NUMBER, str, length); }
+		bool String(const Ch* str, rapidjson::SizeType length, bool = false) { return Text(Value_Tag::STRING, str, length); }
+		bool String(const Ch* str) { return Text(Value_Tag::STRING, str, std::strlen(str)); }
+		bool String(const std::string& str) { return Text(Value_Tag::STRING, str.data(), str.size()); }
+		bool Key(const Ch* str, rapidjson::SizeType length, bool = false) { return Text(Value_Tag::KEY, str, length); }
+		bool Key(const Ch* str) { return Text(Value_Tag::KEY, str, std::strlen(str)); }
+		bool Key(const std::string& str) { return Text(Value_Tag::KEY, str.data(), str.size()); }
+		bool StartObject() { return Event(Value_Tag::START_OBJECT); }
+		bool EndObject(rapidjson::SizeType = 0) { return Event(Value_Tag::END_OBJECT); }
+		bool StartArray() { return Event(Value_Tag::START_ARRAY); }
+		bool EndArray(rapidjson::SizeType = 0) { return Event(Value_Tag::END_ARRAY); }
+
+		bool operator==(const Event_Log& other) const noexcept
+		{
+			return !has_nan && !other.has_nan && words == other.words;
+		}
+
+	private:
+		bool Event(Value_Tag tag)
+		{
+			words.push_back(static_cast<std::uint64_t>(tag));
+			return true;
+		}
+
+		bool Event(Value_Tag tag, std::uint64_t word)
+		{
+			words.push_back(static_cast<std::uint64_t>(tag));
+			words.push_back(word);
+			return true;
+		}
+
+		bool Text(Value_Tag tag, const Ch* str, std::size_t length)
+		{
+			Event(tag, length);
+			const std::size_t first = words.size();
+			words.resize(first + (length + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+			if (length != 0)
+				std::memcpy(words.data() + first, str, length);
+			return true;
+		}
+
+		std::vector<std::uint64_t> words;
+		bool has_nan = false;
+	};
+
+	/**
+	 * @brief True when the Writer of the module writes the same events for left and right.
+	 */
+	template<class Data>
+	bool Same_Writer_Events(const Data& left, const Data& right)
+	{
+		using Writer = typename O::Configuration::Module::Traits<Data>::Writer;
+
+		Event_Log left_events;
+		Event_Log right_events;
+		Writer{}.To_JSON(left_events, left);
+		Writer{}.To_JSON(right_events, right);
+		return left_events == right_events;
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class Data>
+O::Configuration::Application::Digest O::Configuration::Application::Module_Fingerprint(const Data& data)
+{
+	Fingerprint_Writer writer;
+	Detail::Write_Fingerprint(writer, data);
+	return writer.Result();
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Digest O::Configuration::Application::Fingerprint(const Container<Data_Modules...>& container)
+{
+	Fingerprint_Writer writer;
+	Fingerprint_Writer modules;
+
+	auto add = [&]<class Data>(const Data& data)
+		{
+			using Builder = typename O::Configuration::Module::Traits<Data>::Builder;
+
+			modules.Reset();
+			Detail::Write_Fingerprint(modules, data);
+			const Digest digest = modules.Result();
+
+			writer.String(Builder::Key());
+			writer.Uint64(digest.low);
+			writer.Uint64(digest.high);
+		};
+
+	writer.StartArray();
+	(add(container.template Get<Data_Modules>()), ...);
+	writer.EndArray();
+	return writer.Result();
+}
+
+template<class... Data_Modules>
+bool O::Configuration::Application::operator==(const Container<Data_Modules...>& left, const Container<Data_Modules...>& right)
+{
+	auto equal = []<class Data>(const Data& l, const Data& r)
+		{
+			if constexpr (std::equality_comparable<Data>)
+				return l == r;
+			else
+			{
+				static_assert(requires { typename O::Configuration::Module::Traits<Data>::Writer; }, "Container operator== needs an operator== or a Writer for every module");
+				return Detail::Same_Writer_Events(l, r);
+			}
+		};
+	return (equal(left.template Get<Data_Modules>(), right.template Get<Data_Modules>()) && ...);
+}
+
+#endif //CONFIGURATION_APPLICATION_CONTAINER_FINGERPRINT_HPP
@@ -0,0 +1,194 @@
+#ifndef CONFIGURATION_APPLICATION_FINGERPRINT_H
+#define CONFIGURATION_APPLICATION_FINGERPRINT_H
+
+// STL
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+// APPLICATION
+#include "key_dispatch.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief 128 bits fingerprint of a module or a Container, low alone is a 64 bits fingerprint.
+	 */
+	struct Digest
+	{
+		std::uint64_t low = 0;
+		std::uint64_t high = 0;
+
+		bool operator==(const Digest&) const = default;
+
+		/**
+		 * @brief The 16 bytes of the digest, little endian, to be sent to another process.
+		 */
+		std::array<unsigned char, 16> To_Bytes() const noexcept
+		{
+			std::array<unsigned char, 16> bytes;
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				bytes[i] = static_cast<unsigned char>(low >> (8 * i));
+				bytes[8 + i] = static_cast<unsigned char>(high >> (8 * i));
+			}
+			return bytes;
+		}
+
+		/**
+		 * @brief Digest read back from the bytes of To_Bytes.
+		 */
+		static Digest From_Bytes(std::span<const unsigned char, 16> bytes) noexcept
+		{
+			Digest digest;
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				digest.low |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+				digest.high |= static_cast<std::uint64_t>(bytes[8 + i]) << (8 * i);
+			}
+			return digest;
+		}
+	};
+
+} // namespace O::Configuration::Application
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief 64 bits hash of raw bytes, consuming a word per step to hash whole files quickly.
+	 */
+	inline std::uint64_t Hash_Bytes(std::span<const char> bytes) noexcept
+	{
+		std::uint64_t hash = 14695981039346656037ull ^ bytes.size();
+		std::size_t i = 0;
+		for (; i + sizeof(std::uint64_t) <= bytes.size(); i += sizeof(std::uint64_t))
+		{
+			std::uint64_t word;
+			std::memcpy(&word, bytes.data() + i, sizeof(word));
+			hash = std::rotl(hash ^ word, 29) * 0x9e3779b97f4a7c15ull;
+		}
+		std::uint64_t tail = 0;
+		if (i != bytes.size())
+			std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+		return Mix(hash ^ tail);
+	}
+
+	/**
+	 * @brief Tag hashed before every event of a value, shared by all the value fingerprints.
+	 */
+	enum class Value_Tag : std::uint64_t
+	{
+		ABSENT, NULL_VALUE, FALSE_VALUE, TRUE_VALUE, INT, UINT, DOUBLE, RAW_NUMBER, STRING, KEY, START_OBJECT, END_OBJECT, START_ARRAY, END_ARRAY
+	};
+
+	/**
+	 * @brief Two lanes hash state fed a word at a time, finished into a 128 bits Digest.
+	 */
+	struct Hash_State
+	{
+		std::uint64_t a = 0x243f6a8885a308d3ull;
+		std::uint64_t b = 0x13198a2e03707344ull;
+
+		void Feed(std::uint64_t word) noexcept
+		{
+			a = std::rotl(a ^ word, 29) * 0x9e3779b97f4a7c15ull;
+			b = std::rotl(b + word, 37) * 0xc2b2ae3d27d4eb4full ^ a;
+		}
+
+		void Feed_Tag(Value_Tag tag) noexcept
+		{
+			Feed(static_cast<std::uint64_t>(tag));
+		}
+
+		/**
+		 * @brief Feed the length then the bytes, so consecutive strings cannot be confused.
+		 */
+		void Feed_Bytes(const char* str, std::size_t length) noexcept
+		{
+			Feed(length);
+			std::size_t i = 0;
+			for (; i + sizeof(std::uint64_t) <= length; i += sizeof(std::uint64_t))
+			{
+				std::uint64_t word;
+				std::memcpy(&word, str + i, sizeof(word));
+				Feed(word);
+			}
+			if (i != length)
+			{
+				std::uint64_t tail = 0;
+				std::memcpy(&tail, str + i, length - i);
+				Feed(tail);
+			}
+		}
+
+		Digest Finish() const noexcept
+		{
+			return Digest{ Mix(a + std::rotl(b, 17)), Mix(b ^ Mix(a)) };
+		}
+	};
+
+	/**
+	 * @brief rapidjson handler hashing the events of a value into a 64 bits fingerprint.
+	 *
+	 * Every event is tagged and strings are prefixed by their length, so two values share a fingerprint only if they have the same structure, member order included.
+	 * Fingerprint_Writer is the canonical variant, ignoring the member order and the number formatting.
+	 */
+	class Fingerprint_Handler
+	{
+	public:
+		/**
+		 * @brief Fingerprint of a value.
+		 */
+		static std::uint64_t Of(const rapidjson::Value& value)
+		{
+			Fingerprint_Handler handler;
+			value.Accept(handler);
+			return handler.Result();
+		}
+
+		/**
+		 * @brief Fingerprint of a missing value, different from the fingerprint of any value.
+		 */
+		static std::uint64_t Of_Absent() noexcept
+		{
+			Fingerprint_Handler handler;
+			handler.state.Feed_Tag(Value_Tag::ABSENT);
+			return handler.Result();
+		}
+
+		bool Null() { state.Feed_Tag(Value_Tag::NULL_VALUE); return true; }
+		bool Bool(bool b) { state.Feed_Tag(b ? Value_Tag::TRUE_VALUE : Value_Tag::FALSE_VALUE); return true; }
+		bool Int(int i) { return Int64(i); }
+		bool Uint(unsigned u) { return Uint64(u); }
+		bool Int64(std::int64_t i) { state.Feed_Tag(Value_Tag::INT); state.Feed(static_cast<std::uint64_t>(i)); return true; }
+		bool Uint64(std::uint64_t u) { state.Feed_Tag(Value_Tag::UINT); state.Feed(u); return true; }
+		bool Double(double d) { state.Feed_Tag(Value_Tag::DOUBLE); state.Feed(std::bit_cast<std::uint64_t>(d)); return true; }
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool) { state.Feed_Tag(Value_Tag::RAW_NUMBER); state.Feed_Bytes(str, length); return true; }
+		bool String(const char* str, rapidjson::SizeType length, bool) { state.Feed_Tag(Value_Tag::STRING); state.Feed_Bytes(str, length); return true; }
+		bool Key(const char* str, rapidjson::SizeType length, bool) { state.Feed_Tag(Value_Tag::KEY); state.Feed_Bytes(str, length); return true; }
+		bool StartObject() { state.Feed_Tag(Value_Tag::START_OBJECT); return true; }
+		bool EndObject(rapidjson::SizeType) { state.Feed_Tag(Value_Tag::END_OBJECT); return true; }
+		bool StartArray() { state.Feed_Tag(Value_Tag::START_ARRAY); return true; }
+		bool EndArray(rapidjson::SizeType) { state.Feed_Tag(Value_Tag::END_ARRAY); return true; }
+
+		/**
+		 * @brief Fingerprint of the events received so far.
+		 */
+		std::uint64_t Result() const noexcept
+		{
+			return state.Finish().low;
+		}
+
+	private:
+		Hash_State state;
+	};
+
+} // namespace O::Configuration::Application::Detail
+
+#endif //CONFIGURATION_APPLICATION_FINGERPRINT_H
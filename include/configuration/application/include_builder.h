@@ -0,0 +1,137 @@
+#ifndef CONFIGURATION_APPLICATION_INCLUDE_BUILDER_H
+#define CONFIGURATION_APPLICATION_INCLUDE_BUILDER_H
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "json_builder.h"
+#include "parse_context.h"
+#include "thread_pool.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Parsed fragments of the "$include" directives, shared by every build using the cache.
+	 *
+	 * A fragment is reused without being read while the modification time and size of its file are unchanged.
+	 * Otherwise the file is mapped and hashed, and the parsed fragments are looked up by content: files with the same content, or a file touched
+	 * without being modified, share one parse. Fragments are only parsed again when their content changed.
+	 *
+	 * Load is thread safe, the builds of a batch share the cache. The fragments are immutable and stay alive as long as a build holds them.
+	 */
+	class Fragment_Cache
+	{
+	public:
+		using Fragment = std::shared_ptr<const rapidjson::Document>;
+		using Expected_Fragment = O::Expected<Fragment, Error>;
+
+		Fragment_Cache() = default;
+		Fragment_Cache(const Fragment_Cache&) = delete;
+		Fragment_Cache& operator=(const Fragment_Cache&) = delete;
+
+		/**
+		 * @brief Process-wide cache, constructed on first use.
+		 */
+		static Fragment_Cache& Shared();
+
+		/**
+		 * @brief Return the parsed fragment at path, parsing it only when no cached fragment has its content.
+		 *
+		 * @param path Path of the JSON file of the fragment.
+		 * @return Expected_Fragment - On success the Document of the fragment.
+		 *         On error FILE_OPENING_FAILED or JSON_PARSING_FAILED.
+		 */
+		Expected_Fragment Load(const std::filesystem::path& path);
+
+		/**
+		 * @brief Number of paths held by the cache.
+		 */
+		std::size_t Size() const;
+
+		/**
+		 * @brief Number of parses run since the cache was constructed, cache hits excluded.
+		 */
+		std::size_t Parse_Count() const noexcept;
+
+		/**
+		 * @brief Drop every fragment, the ones held by running builds stay alive until they finish.
+		 */
+		void Clear();
+
+	private:
+		struct Path_Entry
+		{
+			std::filesystem::file_time_type write_time;
+			std::uintmax_t size = 0;
+			std::uint64_t content_hash = 0;
+			Fragment fragment;
+		};
+
+		struct Content_Entry
+		{
+			std::size_t size = 0;
+			std::weak_ptr<const rapidjson::Document> fragment;
+		};
+
+		Fragment Find_Content(std::uint64_t content_hash, std::size_t size);
+		void Store(const std::filesystem::path& path, Path_Entry entry);
+
+		mutable std::mutex mutex;
+		std::unordered_map<std::filesystem::path::string_type, Path_Entry> paths;
+		std::unordered_map<std::uint64_t, Content_Entry> contents;
+		std::atomic<std::size_t> parse_count{ 0 };
+	};
+
+	/**
+	 * @brief Same as Build_From_JSON_File, replacing the "$include" directives by the fragments they name before the module builders run.
+	 *
+	 * A directive is an object holding a "$include" string member, the path of a JSON file relative to the file holding the directive:
+	 * @code
+	 * { "tls": { "$include": "fragments/tls.json", "port": 8443 } }
+	 * @endcode
+	 * The object is replaced by the root of the fragment, any value. The other members of the object, when there are some, are merged over the
+	 * fragment which must then be an object: objects member by member, other values replace the fragment value, as with Build_From_JSON_Layers.
+	 * Fragments may include other fragments.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @param fragments Cache of the parsed fragments, Fragment_Cache::Shared() when the caller has none.
+	 * @param mode How the file is read, the fragments are always mapped.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id), INVALID_INCLUDE or INCLUDE_CYCLE for a wrong directive,
+	 *         FILE_OPENING_FAILED or JSON_PARSING_FAILED for a fragment as for the file.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Fragment_Cache& fragments, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_File with a Fragment_Cache, reusing the Document pools and read buffer of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Fragment_Cache& fragments, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_Files, resolving the "$include" directives: the fragments shared by the files are parsed once.
+	 */
+	template<class... Data_Modules>
+	std::vector<Expected_Builder<Data_Modules...>> Build_From_JSON_Files(std::span<const std::filesystem::path> paths, Thread_Pool& pool, Fragment_Cache& fragments, Read_Mode mode = Read_Mode::STREAM);
+} // namespace O::Configuration::Application
+
+#include "include_builder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_INCLUDE_BUILDER_H
@@ -0,0 +1,256 @@
+#ifndef CONFIGURATION_APPLICATION_INCLUDE_BUILDER_HPP
+#define CONFIGURATION_APPLICATION_INCLUDE_BUILDER_HPP
+
+// STL
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+// APPLICATION
+#include "batch_builder.h"
+#include "fingerprint.h"
+#include "include_builder.h"
+#include "json_builder.h"
+#include "layered_builder.h"
+#include "mapped_file.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+inline O::Configuration::Application::Fragment_Cache& O::Configuration::Application::Fragment_Cache::Shared()
+{
+	static Fragment_Cache cache;
+	return cache;
+}
+
+inline O::Configuration::Application::Fragment_Cache::Expected_Fragment O::Configuration::Application::Fragment_Cache::Load(const std::filesystem::path& path)
+{
+	std::error_code time_error, size_error;
+	const auto write_time = std::filesystem::last_write_time(path, time_error);
+	const auto size = std::filesystem::file_size(path, size_error);
+	if (time_error || size_error)
+		return Expected_Fragment::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+	{
+		std::lock_guard lock(mutex);
+		auto found = paths.find(path.native());
+		if (found != paths.end() && found->second.write_time == write_time && found->second.size == size)
+			return Expected_Fragment::Make_Value(found->second.fragment);
+	}
+
+	std::optional<Mapped_File> file = Mapped_File::Open(path);
+	if (!file)
+		return Expected_Fragment::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+	const std::uint64_t content_hash = Detail::Hash_Bytes(std::span<const char>(file->Data(), file->Size()));
+	{
+		std::lock_guard lock(mutex);
+		if (Fragment fragment = Find_Content(content_hash, file->Size()))
+		{
+			Store(path, Path_Entry{ write_time, size, content_hash, fragment });
+			return Expected_Fragment::Make_Value(std::move(fragment));
+		}
+	}
+
+	// parsed without the lock, builds loading other fragments are not held back
+	auto document = std::make_shared<rapidjson::Document>();
+	parse_count.fetch_add(1, std::memory_order_relaxed);
+	document->Parse(file->Data(), file->Size());
+	if (document->HasParseError())
+		return Expected_Fragment::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+	std::lock_guard lock(mutex);
+	// another build may have parsed the same content meanwhile, the first one is kept
+	Fragment fragment = Find_Content(content_hash, file->Size());
+	if (!fragment)
+	{
+		fragment = std::move(document);
+		contents[content_hash] = Content_Entry{ file->Size(), fragment };
+	}
+	Store(path, Path_Entry{ write_time, size, content_hash, fragment });
+	return Expected_Fragment::Make_Value(std::move(fragment));
+}
+
+inline std::size_t O::Configuration::Application::Fragment_Cache::Size() const
+{
+	std::lock_guard lock(mutex);
+	return paths.size();
+}
+
+inline std::size_t O::Configuration::Application::Fragment_Cache::Parse_Count() const noexcept
+{
+	return parse_count.load(std::memory_order_relaxed);
+}
+
+inline void O::Configuration::Application::Fragment_Cache::Clear()
+{
+	std::lock_guard lock(mutex);
+	paths.clear();
+	contents.clear();
+}
+
+inline O::Configuration::Application::Fragment_Cache::Fragment O::Configuration::Application::Fragment_Cache::Find_Content(std::uint64_t content_hash, std::size_t size)
+{
+	auto found = contents.find(content_hash);
+	if (found == contents.end() || found->second.size != size)
+		return nullptr;
+
+	Fragment fragment = found->second.fragment.lock();
+	if (!fragment)
+		contents.erase(found);
+	return fragment;
+}
+
+inline void O::Configuration::Application::Fragment_Cache::Store(const std::filesystem::path& path, Path_Entry entry)
+{
+	Path_Entry& slot = paths[path.native()];
+	const std::uint64_t previous_hash = slot.content_hash;
+	const bool replaced = slot.fragment && previous_hash != entry.content_hash;
+	slot = std::move(entry);
+
+	// drop the content the path held when no other path shares it anymore
+	if (replaced)
+		if (auto previous = contents.find(previous_hash); previous != contents.end() && previous->second.fragment.expired())
+			contents.erase(previous);
+}
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Member name of the include directive.
+	 */
+	inline constexpr const char* INCLUDE_KEY = "$include";
+
+	/**
+	 * @brief Replace the include directives of a Document by copies of their fragments, allocated from the Document.
+	 */
+	class Include_Resolver
+	{
+	public:
+		Include_Resolver(Fragment_Cache& fragments, rapidjson::Document::AllocatorType& allocator) :
+			fragments(fragments), allocator(allocator)
+		{
+		}
+
+		/**
+		 * @brief Resolve the directives of the root of the file at path.
+		 */
+		std::optional<Error> Resolve_File(rapidjson::Value& root, const std::filesystem::path& path)
+		{
+			const std::filesystem::path file = Normalize(path);
+			stack.push_back(file);
+			std::optional<Error> error = Resolve(root, file.parent_path());
+			stack.pop_back();
+			return error;
+		}
+
+	private:
+		static std::filesystem::path Normalize(const std::filesystem::path& path)
+		{
+			std::error_code ec;
+			std::filesystem::path canonical = std::filesystem::weakly_canonical(path, ec);
+			return ec ? path.lexically_normal() : canonical;
+		}
+
+		static std::optional<Error> Include_Error(Parse_Error error)
+		{
+			return Error{ "", static_cast<int>(error) };
+		}
+
+		std::optional<Error> Resolve(rapidjson::Value& value, const std::filesystem::path& directory)
+		{
+			if (value.IsArray())
+			{
+				for (rapidjson::Value& element : value.GetArray())
+					if (std::optional<Error> error = Resolve(element, directory))
+						return error;
+				return std::nullopt;
+			}
+			if (!value.IsObject())
+				return std::nullopt;
+
+			auto directive = value.FindMember(INCLUDE_KEY);
+			for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+				if (member != directive)
+					if (std::optional<Error> error = Resolve(member->value, directory))
+						return error;
+			if (directive == value.MemberEnd())
+				return std::nullopt;
+
+			if (!directive->value.IsString())
+				return Include_Error(INVALID_INCLUDE);
+			const std::filesystem::path file = Normalize(directory / std::filesystem::path(std::string_view(directive->value.GetString(), directive->value.GetStringLength())));
+			if (std::find(stack.begin(), stack.end(), file) != stack.end())
+				return Include_Error(INCLUDE_CYCLE);
+
+			Fragment_Cache::Expected_Fragment fragment = fragments.Load(file);
+			if (!fragment)
+				return fragment.Error();
+
+			rapidjson::Value included(*fragment.Value(), allocator);
+			stack.push_back(file);
+			std::optional<Error> error = Resolve(included, file.parent_path());
+			stack.pop_back();
+			if (error)
+				return error;
+
+			value.EraseMember(directive);
+			if (value.MemberCount() != 0)
+			{
+				if (!included.IsObject())
+					return Include_Error(INVALID_INCLUDE);
+				Merge_Layer_Value(included, value, allocator);
+			}
+			value.Swap(included);
+			return std::nullopt;
+		}
+
+		Fragment_Cache& fragments;
+		rapidjson::Document::AllocatorType& allocator;
+		// files being expanded, a directive naming one of them is a cycle
+		std::vector<std::filesystem::path> stack;
+	};
+
+	/**
+	 * @brief Resolve the include directives of doc, parsed from path, then build the container from it.
+	 */
+	template<class... Data_Modules, class Document>
+	Expected_Builder<Data_Modules...> Build_Document_With_Includes(Document& doc, const std::filesystem::path& path, Fragment_Cache& fragments)
+	{
+		Include_Resolver resolver(fragments, doc.GetAllocator());
+		if (std::optional<Error> error = resolver.Resolve_File(doc, path))
+			return Expected_Builder<Data_Modules...>::Make_Error(*error);
+		return Build_From_JSON_Document<Data_Modules...>(doc);
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Fragment_Cache& fragments, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
+	rapidjson::Document doc;
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode,
+		[&](const rapidjson::Value&) { return Detail::Build_Document_With_Includes<Data_Modules...>(doc, path, fragments); });
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Fragment_Cache& fragments, Read_Mode mode)
+{
+	Parse_Context::Document& doc = context.Acquire_Document();
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, context.Read_Buffer(), mode,
+		[&](const rapidjson::Value&) { return Detail::Build_Document_With_Includes<Data_Modules...>(doc, path, fragments); });
+}
+
+template<class... Data_Modules>
+std::vector<O::Configuration::Application::Expected_Builder<Data_Modules...>> O::Configuration::Application::Build_From_JSON_Files(std::span<const std::filesystem::path> paths, Thread_Pool& pool, Fragment_Cache& fragments, Read_Mode mode)
+{
+	return Detail::Run_Batch<Expected_Builder<Data_Modules...>>(paths.size(), pool, [&](std::size_t index, Parse_Context& context)
+		{
+			return Build_From_JSON_File<Data_Modules...>(paths[index], context, fragments, mode);
+		});
+}
+
+#endif //CONFIGURATION_APPLICATION_INCLUDE_BUILDER_HPP
@@ -0,0 +1,69 @@
+#ifndef CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_H
+#define CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_H
+
+// STL
+#include <filesystem>
+#include <string_view>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "json_builder.h"
+#include "parse_context.h"
+#include "shared_container.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Alias describing the expected return type of Rebuild_From_JSON_* functions.
+	 */
+	template<class... Data_Modules>
+	using Expected_Shared_Builder = O::Expected<Shared_Container<Data_Modules...>, Error>;
+
+	/**
+	 * @brief Build a Shared_Container from a JSON file, running only the builders of the modules whose value changed since previous.
+	 *
+	 * Each module value is fingerprinted; when the fingerprint matches the one stored in previous the module is shared, otherwise it is rebuilt.
+	 * A module whose key disappeared is reset to its default value.
+	 *
+	 * @note The whole file is still parsed and hashed, only the module builders and copies are saved.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @param previous Container of the previous build, a default constructed one builds every module.
+	 * @param mode How the file is read.
+	 * @return Expected_Shared_Builder<Data_Modules...> - On success contains the new container, previous is left untouched.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Shared_Builder<Data_Modules...> Rebuild_From_JSON_File(const std::filesystem::path& path, const Shared_Container<Data_Modules...>& previous, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Rebuild_From_JSON_File, reusing the Document pools and read buffer of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Shared_Builder<Data_Modules...> Rebuild_From_JSON_File(const std::filesystem::path& path, const Shared_Container<Data_Modules...>& previous, Parse_Context& context, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Build a Shared_Container from an in-memory JSON string, running only the builders of the modules whose value changed since previous.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data JSON text to parse.
+	 * @param previous Container of the previous build, a default constructed one builds every module.
+	 * @return Expected_Shared_Builder<Data_Modules...> - On success contains the new container, previous is left untouched.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Shared_Builder<Data_Modules...> Rebuild_From_JSON_String(std::string_view data, const Shared_Container<Data_Modules...>& previous);
+
+	/**
+	 * @brief Same as Rebuild_From_JSON_String, reusing the Document pools of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Shared_Builder<Data_Modules...> Rebuild_From_JSON_String(std::string_view data, const Shared_Container<Data_Modules...>& previous, Parse_Context& context);
+} // namespace O::Configuration::Application
+
+#include "incremental_builder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_H
@@ -0,0 +1,107 @@
+#ifndef CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_HPP
+#define CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_HPP
+
+// STL
+#include <memory>
+#include <span>
+#include <type_traits>
+
+// APPLICATION
+#include "fingerprint.h"
+#include "incremental_builder.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// UTILS
+#include "utils/tuple_helper.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application::Detail
+{
+	template<class... Data_Modules>
+	Expected_Shared_Builder<Data_Modules...> Rebuild_From_JSON_Document(const rapidjson::Value& doc, const Shared_Container<Data_Modules...>& previous)
+	{
+		if (!doc.IsObject())
+			return Expected_Shared_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+
+		const auto members = Find_Module_Members<Data_Modules...>(doc);
+
+		// start from a copy of previous so unchanged modules are shared
+		Expected_Shared_Builder<Data_Modules...> result = Expected_Shared_Builder<Data_Modules...>::Make_Value(previous);
+		Shared_Container<Data_Modules...>& container = result.Value();
+
+		bool ok = true;
+		std::size_t index = 0;
+
+		O::For_Each_In_Tuple(container.modules, [&](auto& module_part)
+			{
+				const std::size_t i = index++;
+				if (!ok) return;
+
+				auto member = members[i];
+				const std::uint64_t fingerprint = member == doc.MemberEnd() ? Fingerprint_Handler::Of_Absent() : Fingerprint_Handler::Of(member->value);
+				if (container.fingerprints[i] == fingerprint) return;
+
+				using ModuleType = typename std::decay_t<decltype(module_part)>::element_type;
+				using Builder = typename O::Configuration::Module::Traits<std::remove_const_t<ModuleType>>::Builder;
+
+				if (member == doc.MemberEnd())
+				{
+					module_part = std::make_shared<ModuleType>();
+					container.fingerprints[i] = fingerprint;
+					return;
+				}
+
+				Builder builder;
+				auto opt = builder.Load_From_JSON(member->value);
+
+				if (opt)
+				{
+					result = Expected_Shared_Builder<Data_Modules...>::Make_Error(Error{ Builder::Key(), static_cast<int>(*opt) });
+					ok = false;
+					return;
+				}
+
+				module_part = std::make_shared<ModuleType>(std::move(*builder));
+				container.fingerprints[i] = fingerprint;
+			});
+
+		return result;
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Shared_Builder<Data_Modules...> O::Configuration::Application::Rebuild_From_JSON_File(const std::filesystem::path& path, const Shared_Container<Data_Modules...>& previous, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
+	rapidjson::Document doc;
+	return Detail::Parse_File_And_Build<Expected_Shared_Builder<Data_Modules...>>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode,
+		[&previous](const rapidjson::Value& root) { return Detail::Rebuild_From_JSON_Document<Data_Modules...>(root, previous); });
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Shared_Builder<Data_Modules...> O::Configuration::Application::Rebuild_From_JSON_File(const std::filesystem::path& path, const Shared_Container<Data_Modules...>& previous, Parse_Context& context, Read_Mode mode)
+{
+	return Detail::Parse_File_And_Build<Expected_Shared_Builder<Data_Modules...>>(path, context.Acquire_Document(), context.Read_Buffer(), mode,
+		[&previous](const rapidjson::Value& root) { return Detail::Rebuild_From_JSON_Document<Data_Modules...>(root, previous); });
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Shared_Builder<Data_Modules...> O::Configuration::Application::Rebuild_From_JSON_String(std::string_view data, const Shared_Container<Data_Modules...>& previous)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Expected_Shared_Builder<Data_Modules...>>(data, doc,
+		[&previous](const rapidjson::Value& root) { return Detail::Rebuild_From_JSON_Document<Data_Modules...>(root, previous); });
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Shared_Builder<Data_Modules...> O::Configuration::Application::Rebuild_From_JSON_String(std::string_view data, const Shared_Container<Data_Modules...>& previous, Parse_Context& context)
+{
+	return Detail::Parse_String_And_Build<Expected_Shared_Builder<Data_Modules...>>(data, context.Acquire_Document(),
+		[&previous](const rapidjson::Value& root) { return Detail::Rebuild_From_JSON_Document<Data_Modules...>(root, previous); });
+}
+
+#endif //CONFIGURATION_APPLICATION_INCREMENTAL_BUILDER_HPP
@@ -0,0 +1,49 @@
+#ifndef CONFIGURATION_APPLICATION_INSTRUMENTATION_H
+#define CONFIGURATION_APPLICATION_INSTRUMENTATION_H
+
+// STL
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Step of a build or a write reported to an instrumentation policy.
+	 */
+	enum class Phase {
+		PARSE,  /**< Parsing of the whole document, the key is empty and the size is the input size in bytes. */
+		LOAD,   /**< Load_From_JSON of a module, the size is the serialized size of its JSON value in bytes. */
+		WRITE   /**< To_JSON of a module, the size is the number of bytes it wrote, the separator after its key included. */
+	};
+
+	/**
+	 * @brief Compile-time instrumentation policy of the instrumented Build_From_JSON_* and Write_As_JSON_* overloads.
+	 *
+	 * Begin() is called before a step and returns a Scope handed back to End() with the step description once it is done.
+	 * When ENABLED is false the library does not compute the sizes and the calls compile to nothing.
+	 */
+	template<class T>
+	concept Instrumentation_Policy = requires(T& instrumentation, typename T::Scope scope, Phase phase, std::string_view key, std::size_t size)
+	{
+		{ T::ENABLED } -> std::convertible_to<bool>;
+		{ instrumentation.Begin() } -> std::same_as<typename T::Scope>;
+		instrumentation.End(scope, phase, key, size);
+	};
+
+	/**
+	 * @brief Policy recording nothing, used by the overloads without instrumentation.
+	 */
+	struct No_Instrumentation
+	{
+		struct Scope {};
+
+		static constexpr bool ENABLED = false;
+
+		Scope Begin() noexcept { return {}; }
+		void End(Scope, Phase, std::string_view, std::size_t) noexcept {}
+	};
+
+} // namespace O::Configuration::Application
+
+#endif //CONFIGURATION_APPLICATION_INSTRUMENTATION_H
@@ -4,6 +4,7 @@
 // STL
 #include <tuple>
 #include <filesystem>
+#include <memory_resource>
 #include <string_view>
 
 // UTILS
@@ -11,6 +12,10 @@
 
 // APPLICATION
 #include "container.h"
+#include "instrumentation.h"
+#include "parse_context.h"
+#include "parse_policy.h"
+#include "thread_pool.h"
 
 namespace O::Configuration::Application
 {
@@ -22,7 +27,10 @@ namespace O::Configuration::Application
 	enum Parse_Error {
 		JSON_PARSING_FAILED,        /**< RapidJSON failed to parse the input. */
 		FILE_OPENING_FAILED,        /**< The file could not be opened for reading. */
-		JSON_ROOT_IS_NOT_AN_OBJECT  /**< The document root must be a JSON object. */
+		JSON_ROOT_IS_NOT_AN_OBJECT, /**< The document root must be a JSON object. */
+		CBOR_PARSING_FAILED,        /**< The input of Build_From_CBOR_* is not a single well formed CBOR item with a JSON equivalent. */
+		INVALID_INCLUDE,            /**< A "$include" directive does not name a file, or has sibling members while the fragment is not an object. */
+		INCLUDE_CYCLE               /**< A fragment includes itself, directly or through other fragments. */
 	};
 
 	/**
@@ -36,6 +44,14 @@ namespace O::Configuration::Application
 		int error_id;                 /**< Numeric error code: either Parse_Error or module-specific Error enumerator cast to int. */
 	};
 
+	/**
+	 * @brief How Build_From_JSON_File reads the file.
+	 */
+	enum class Read_Mode {
+		STREAM,        /**< Read through a 64 KB buffer, strings are copied into the Document allocator. */
+		MEMORY_MAPPED  /**< Parse in-situ a private copy-on-write mapping of the file, strings point into the mapped pages. */
+	};
+
 	/**
 	 * @brief Alias describing the expected return type of Build_From_JSON_* functions.
 	 *
@@ -50,11 +66,25 @@ namespace O::Configuration::Application
 	 *
 	 * @tparam Data_Modules List of module data types to include in the container.
 	 * @param path Path to the JSON file to parse.
+	 * @param mode Read_Mode::MEMORY_MAPPED avoids copying the file and its strings, the mapping only lives for the duration of the call.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Build the application Container from a JSON file on disk, reusing the Document pools and read buffer of context.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @param context Parse_Context providing the Document, it must not be used by another build at the same time.
+	 * @param mode Read_Mode::MEMORY_MAPPED avoids copying the file and its strings, the mapping only lives for the duration of the call.
 	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
 	 *         On error contains Error (module name and error id).
 	 */
 	template<class... Data_Modules>
-	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path);
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Read_Mode mode = Read_Mode::STREAM);
 
 	/**
 	 * @brief Build the application Container from an in-memory JSON string.
@@ -66,6 +96,146 @@ namespace O::Configuration::Application
 	 */
 	template<class... Data_Modules>
 	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data);
+
+	/**
+	 * @brief Build the application Container from an in-memory JSON string, reusing the Document pools of context.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data JSON text to parse.
+	 * @param context Parse_Context providing the Document, it must not be used by another build at the same time.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Parse_Context& context);
+
+	/**
+	 * @brief Build the application Container from a JSON file on disk, running the module builders in parallel on pool.
+	 *
+	 * The file is parsed on the calling thread, then each module builder runs as a task of pool.
+	 * Builders must not share mutable state. The reported error is the first one in module order, as with the sequential build.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @param pool Pool running the builders, Thread_Pool::Shared() when the caller has none.
+	 * @param mode How the file is read.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Thread_Pool& pool, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as the parallel Build_From_JSON_File, reusing the Document pools and read buffer of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Thread_Pool& pool, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Build the application Container from an in-memory JSON string, running the module builders in parallel on pool.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data JSON text to parse.
+	 * @param pool Pool running the builders, Thread_Pool::Shared() when the caller has none.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Thread_Pool& pool);
+
+	/**
+	 * @brief Same as the parallel Build_From_JSON_String, reusing the Document pools of context.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Parse_Context& context, Thread_Pool& pool);
+
+	/**
+	 * @brief Build the application Container from a rapidjson input stream without building a Document.
+	 *
+	 * The events of each top-level key are forwarded to the module builder while the input is parsed.
+	 * Builders deriving from Module::JSON_SAX_Builder receive them directly, other builders receive their sub-tree rebuilt as a rapidjson::Value.
+	 * Values of keys that match no module are skipped without being allocated.
+	 *
+	 * @note A module error is reported as soon as the module value is complete, so the first error follows the document order and not the module order.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @tparam Input_Stream rapidjson input stream (rapidjson::FileReadStream, rapidjson::StringStream, ...).
+	 * @param is Stream positioned at the beginning of the JSON text.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id).
+	 */
+	template<class... Data_Modules, class Input_Stream>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Stream(Input_Stream& is);
+
+	/**
+	 * @brief Same as Build_From_JSON_File with a Parse_Context, reporting the parse and the Load_From_JSON of each module to instrumentation.
+	 *
+	 * @tparam Instrumentation Policy receiving the steps, Trace_Recorder or No_Instrumentation.
+	 */
+	template<class... Data_Modules, Instrumentation_Policy Instrumentation>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Instrumentation& instrumentation, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_String with a Parse_Context, reporting the parse and the Load_From_JSON of each module to instrumentation.
+	 *
+	 * @tparam Instrumentation Policy receiving the steps, Trace_Recorder or No_Instrumentation.
+	 */
+	template<class... Data_Modules, Instrumentation_Policy Instrumentation>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Parse_Context& context, Instrumentation& instrumentation);
+
+	/**
+	 * @brief Same as Build_From_JSON_String, building the module data from resource.
+	 *
+	 * Builders constructible from a std::pmr::memory_resource* (see Module::JSON_Builder) construct and fill their data with it,
+	 * modules missing from the document are constructed with it when they use allocators.
+	 * The modules are moved into the Container, they keep their allocator: resource must outlive the Container.
+	 *
+	 * @note Move assigning a module built from another resource copies it. Build_Arena_From_JSON_String keeps the resource with the Container.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, std::pmr::memory_resource* resource);
+
+	/**
+	 * @brief Same as Build_From_JSON_File, building the module data from resource. See the Build_From_JSON_String overload.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, std::pmr::memory_resource* resource, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_String, parsing with the rapidjson flags of policy.
+	 *
+	 * @code
+	 * auto expected = Build_From_JSON_String<MyModuleData>(text, Relaxed_Parse{});
+	 * @endcode
+	 *
+	 * @tparam Policy Default_Parse, Relaxed_Parse, Strict_Parse, Fast_Parse or any Parse_Policy<Parse_Option...>.
+	 */
+	template<class... Data_Modules, JSON_Parse_Policy Policy>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Policy policy);
+
+	/**
+	 * @brief Same as Build_From_JSON_String with a Parse_Context, parsing with the rapidjson flags of policy.
+	 */
+	template<class... Data_Modules, JSON_Parse_Policy Policy>
+	Expected_Builder<Data_Modules...> Build_From_JSON_String(std::string_view data, Parse_Context& context, Policy policy);
+
+	/**
+	 * @brief Same as Build_From_JSON_File, parsing with the rapidjson flags of policy.
+	 */
+	template<class... Data_Modules, JSON_Parse_Policy Policy>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Policy policy, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_File with a Parse_Context, parsing with the rapidjson flags of policy.
+	 */
+	template<class... Data_Modules, JSON_Parse_Policy Policy>
+	Expected_Builder<Data_Modules...> Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Policy policy, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Build_From_JSON_Stream, parsing with the rapidjson flags of policy (INSITU aside).
+	 */
+	template<class... Data_Modules, class Input_Stream, JSON_Parse_Policy Policy>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Stream(Input_Stream& is, Policy policy);
 } // namespace O::Configuration::Application
 
 #include "json_builder.hpp"
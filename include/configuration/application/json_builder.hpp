@@ -2,14 +2,32 @@
 #define CONFIGURATION_APPLICATION_JSON_BUILDER_HPP
 
 // STL
+#include <array>
+#include <atomic>
 #include <tuple>
+#include <utility>
 #include <filesystem>
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <type_traits>
 
 // APPLICATION
 #include "container.h"
+#include "instrumentation.h"
 #include "json_builder.h"
+#include "json_stream_handler.h"
+#include "json_writer.h"
+#include "key_dispatch.h"
+#include "mapped_file.h"
+#include "parse_context.h"
+#include "parse_policy.h"
+#include "thread_pool.h"
 
 // MODULE
 #include "configuration/module/traits.h"
@@ -20,83 +38,491 @@
 // RAPIDJSON
 #include <rapidjson/document.h>
 #include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Single pass over the root members, return for each module the member holding its key or MemberEnd().
+	 *
+	 * The first occurrence of a key wins.
+	 */
+	template<class... Data_Modules>
+	std::array<rapidjson::Value::ConstMemberIterator, sizeof...(Data_Modules)> Find_Module_Members(const rapidjson::Value& doc)
+	{
+		using Key_Table = Key_Table<Data_Modules...>;
+
+		std::array<rapidjson::Value::ConstMemberIterator, Key_Table::COUNT> members;
+		members.fill(doc.MemberEnd());
+		for (auto member = doc.MemberBegin(); member != doc.MemberEnd(); ++member)
+		{
+			std::size_t index = Key_Table::Find(std::string_view(member->name.GetString(), member->name.GetStringLength()));
+			if (index != Key_Table::COUNT && members[index] == doc.MemberEnd())
+				members[index] = member;
+		}
+		return members;
+	}
+
+	/**
+	 * @brief Size in bytes of value written without whitespace, the input size reported to the instrumentation policies.
+	 */
+	inline std::size_t Serialized_Size(const rapidjson::Value& value)
+	{
+		Counting_Sink os;
+		rapidjson::Writer<Counting_Sink> writer(os);
+		value.Accept(writer);
+		return os.Size();
+	}
+} // namespace O::Configuration::Application::Detail
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Build_From_JSON_Document reporting the Load_From_JSON of every module to instrumentation.
+	 */
+	template<class... Data_Modules, class Instrumentation>
+	Expected_Builder<Data_Modules...> Build_Document(const rapidjson::Value& doc, Instrumentation& instrumentation)
+	{
+		if (!doc.IsObject())
+			return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+
+		const auto members = Find_Module_Members<Data_Modules...>(doc);
+
+		Expected_Builder<Data_Modules...> result = Expected_Builder<Data_Modules...>::Make_Value();
+		Container<Data_Modules...>& container = result.Value();
+
+		bool ok = true;
+		std::size_t index = 0;
+
+		O::For_Each_In_Tuple(container.modules, [&](auto& module_part)
+			{
+				auto member = members[index++];
+				if (!ok || member == doc.MemberEnd()) return;
+
+				using ModuleType = std::decay_t<decltype(module_part)>;
+				using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+
+				// measured before the clock starts, it is not part of the load time
+				std::size_t input_size = 0;
+				if constexpr (Instrumentation::ENABLED)
+					input_size = Serialized_Size(member->value);
+
+				auto scope = instrumentation.Begin();
+				Builder builder;
+				auto opt = builder.Load_From_JSON(member->value);
+				instrumentation.End(scope, Phase::LOAD, Builder::Key(), input_size);
+
+				if (opt)
+				{
+					result = Expected_Builder<Data_Modules...>::Make_Error(Error{ Builder::Key(), static_cast<int>(*opt) });
+					ok = false;
+					return;
+				}
+
+				module_part = std::move(*builder);
+			});
+
+		return result;
+	}
+
+	/**
+	 * @brief Document builder of the instrumented overloads, reporting the parse that ran before it.
+	 *
+	 * Report_Parse must be called once the parse is over whether the builder ran or not.
+	 */
+	template<class Instrumentation, class... Data_Modules>
+	class Instrumented_Document_Builder
+	{
+	public:
+		Instrumented_Document_Builder(Instrumentation& instrumentation, std::size_t input_size) :
+			instrumentation(instrumentation), input_size(input_size), parse_scope(instrumentation.Begin())
+		{
+		}
+
+		Expected_Builder<Data_Modules...> operator()(const rapidjson::Value& doc)
+		{
+			Report_Parse();
+			return Build_Document<Data_Modules...>(doc, instrumentation);
+		}
+
+		void Report_Parse()
+		{
+			if (!parse_reported)
+				instrumentation.End(parse_scope, Phase::PARSE, std::string_view(), input_size);
+			parse_reported = true;
+		}
+
+	private:
+		Instrumentation& instrumentation;
+		std::size_t input_size;
+		typename Instrumentation::Scope parse_scope;
+		bool parse_reported = false;
+	};
+} // namespace O::Configuration::Application::Detail
 
 template<class... Data_Modules>
-O::Configuration::Application::Expected_Builder<Data_Modules...> Build_From_JSON_Document(const rapidjson::Document& doc)
+O::Configuration::Application::Expected_Builder<Data_Modules...> Build_From_JSON_Document(const rapidjson::Value& doc)
 {
-	using namespace O::Configuration::Application;
+	O::Configuration::Application::No_Instrumentation instrumentation;
+	return O::Configuration::Application::Detail::Build_Document<Data_Modules...>(doc, instrumentation);
+}
 
-	if (!doc.IsObject())
-		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Parse in-situ the null terminated text into doc and pass the root to build, parse errors are returned as Result errors.
+	 *
+	 * The Document strings point into text, it must outlive build.
+	 */
+	template<class Result, class Policy = Default_Parse, class Document, class Build>
+	Result Parse_Insitu_And_Build(char* text, Document& doc, Build&& build)
+	{
+		rapidjson::ParseResult r = doc.template ParseInsitu<Policy::FLAGS & ~INSITU>(text);
 
-	Expected_Builder<Data_Modules...> result = Expected_Builder<Data_Modules...>::Make_Value();
-	Container<Data_Modules...>& container = result.Value();
+		if (!r)
+			return Result::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
 
-	bool ok = true;
+		return build(static_cast<const rapidjson::Value&>(doc));
+	}
 
-	O::For_Each_In_Tuple(container.modules, [&](auto& module_part)
+	/**
+	 * @brief Parse the file into doc and pass the root to build, parse errors are returned as Result errors.
+	 */
+	template<class Result, class Policy = Default_Parse, class Document, class Build>
+	Result Parse_File_And_Build(const std::filesystem::path& path, Document& doc, std::span<char> read_buffer, Read_Mode mode, Build&& build)
+	{
+		if (mode == Read_Mode::MEMORY_MAPPED)
 		{
-			if (!ok) return;
+			std::optional<Mapped_File> file = Mapped_File::Open(path);
+			if (!file)
+				return Result::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
 
-			using ModuleType = std::decay_t<decltype(module_part)>;
-			using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+			// the Document strings point into the mapping, it must outlive the module builders
+			return Parse_Insitu_And_Build<Result, Policy>(file->Data(), doc, std::forward<Build>(build));
+		}
+
+		FILE* fp = std::fopen(path.generic_string().c_str(), "rb");
+		if (!fp)
+			return Result::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+		rapidjson::FileReadStream is(fp, read_buffer.data(), read_buffer.size());
+		rapidjson::ParseResult r = doc.template ParseStream<Policy::FLAGS & ~INSITU>(is);
 
-			const char* key = Builder::Key();
-			if (!doc.HasMember(key)) return;
+		std::fclose(fp);
 
-			Builder builder;
-			auto opt = builder.Load_From_JSON(doc[key]);
+		if (!r)
+			return Result::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
 
-			if (opt)
+		return build(static_cast<const rapidjson::Value&>(doc));
+	}
+
+	/**
+	 * @brief Parse data into doc and pass the root to build, parse errors are returned as Result errors.
+	 */
+	template<class Result, class Policy = Default_Parse, class Document, class Build>
+	Result Parse_String_And_Build(std::string_view data, Document& doc, Build&& build)
+	{
+		if constexpr ((Policy::FLAGS & INSITU) != 0)
+		{
+			// one copy into the Document allocator, released with the Document strings
+			char* text = static_cast<char*>(doc.GetAllocator().Malloc(data.size() + 1));
+			std::memcpy(text, data.data(), data.size());
+			text[data.size()] = '\0';
+			return Parse_Insitu_And_Build<Result, Policy>(text, doc, std::forward<Build>(build));
+		}
+		else
+		{
+			rapidjson::ParseResult r =
+				doc.template Parse<Policy::FLAGS>(data.data(),
+					static_cast<rapidjson::SizeType>(data.size()));
+
+			if (!r)
+				return Result::Make_Error(
+					Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+			return build(static_cast<const rapidjson::Value&>(doc));
+		}
+	}
+
+	/**
+	 * @brief Read buffer of the file builders called without a Parse_Context, only the stream mode needs one.
+	 */
+	inline std::unique_ptr<char[]> Make_Read_Buffer(Read_Mode mode)
+	{
+		return std::unique_ptr<char[]>(mode == Read_Mode::STREAM ? new char[Parse_Context::READ_BUFFER_SIZE] : nullptr);
+	}
+
+	/**
+	 * @brief Build the module at index I into the container, errors are stored in errors[I].
+	 *
+	 * first_error holds the smallest index that failed so far, the modules after it are skipped since their result cannot be reported.
+	 */
+	template<std::size_t I, class... Data_Modules>
+	void Build_Module(const rapidjson::Value& doc, const std::array<rapidjson::Value::ConstMemberIterator, sizeof...(Data_Modules)>& members, Container<Data_Modules...>& container, std::array<std::optional<Error>, sizeof...(Data_Modules)>& errors, std::atomic<std::size_t>& first_error)
+	{
+		auto member = members[I];
+		if (member == doc.MemberEnd() || first_error.load(std::memory_order_relaxed) < I)
+			return;
+
+		using ModuleType = std::tuple_element_t<I, std::tuple<Data_Modules...>>;
+		using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+
+		Builder builder;
+		auto opt = builder.Load_From_JSON(member->value);
+
+		if (opt)
+		{
+			errors[I] = Error{ Builder::Key(), static_cast<int>(*opt) };
+			std::size_t current = first_error.load(std::memory_order_relaxed);
+			while (I < current && !first_error.compare_exchange_weak(current, I, std::memory_order_relaxed))
+				;
+			return;
+		}
+
+		std::get<I>(container.modules) = std::move(*builder);
+	}
+
+	/**
+	 * @brief Same as Build_From_JSON_Document, running the module builders as tasks of pool.
+	 *
+	 * The reported error is the first one in module order, as with the sequential build.
+	 */
+	template<class... Data_Modules, std::size_t... I>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Document_Parallel(const rapidjson::Value& doc, Thread_Pool& pool, std::index_sequence<I...>)
+	{
+		if (!doc.IsObject())
+			return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+
+		const auto members = Find_Module_Members<Data_Modules...>(doc);
+
+		Expected_Builder<Data_Modules...> result = Expected_Builder<Data_Modules...>::Make_Value();
+		Container<Data_Modules...>& container = result.Value();
+
+		std::array<std::optional<Error>, sizeof...(Data_Modules)> errors;
+		std::atomic<std::size_t> first_error{ sizeof...(Data_Modules) };
+
+		const std::array<Thread_Pool::Task, sizeof...(Data_Modules)> tasks = {
+			Thread_Pool::Task([&] { Build_Module<I, Data_Modules...>(doc, members, container, errors, first_error); })...
+		};
+		pool.Run(tasks);
+
+		for (const std::optional<Error>& error : errors)
+			if (error)
+				return Expected_Builder<Data_Modules...>::Make_Error(*error);
+
+		return result;
+	}
+
+	template<class... Data_Modules>
+	auto Parallel_Document_Builder(Thread_Pool& pool)
+	{
+		return [&pool](const rapidjson::Value& doc) { return Build_From_JSON_Document_Parallel<Data_Modules...>(doc, pool, std::index_sequence_for<Data_Modules...>{}); };
+	}
+
+	/**
+	 * @brief Builder of a module, constructed from resource when it accepts one.
+	 */
+	template<class Builder>
+	Builder Make_Builder(std::pmr::memory_resource* resource)
+	{
+		if constexpr (std::is_constructible_v<Builder, std::pmr::memory_resource*>)
+			return Builder(resource);
+		else
+			return Builder();
+	}
+
+	/**
+	 * @brief Same as Build_From_JSON_Document, the module data is built from resource.
+	 *
+	 * The modules are move constructed into the container since assigning them would copy their content into the allocator of the destination.
+	 */
+	template<class... Data_Modules, std::size_t... I>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Document_With_Resource(const rapidjson::Value& doc, std::pmr::memory_resource* resource, std::index_sequence<I...>)
+	{
+		if (!doc.IsObject())
+			return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+
+		const auto members = Find_Module_Members<Data_Modules...>(doc);
+		std::optional<Error> error;
+
+		auto load = [&]<class ModuleType>(std::type_identity<ModuleType>, rapidjson::Value::ConstMemberIterator member) -> ModuleType
+		{
+			using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+
+			if (error || member == doc.MemberEnd())
+				return std::make_obj_using_allocator<ModuleType>(std::pmr::polymorphic_allocator<>(resource));
+
+			Builder builder = Make_Builder<Builder>(resource);
+			if (auto opt = builder.Load_From_JSON(member->value))
 			{
-				result = Expected_Builder<Data_Modules...>::Make_Error(Error{ key, static_cast<int>(*opt) });
-				ok = false;
-				return;
+				error = Error{ Builder::Key(), static_cast<int>(*opt) };
+				return std::make_obj_using_allocator<ModuleType>(std::pmr::polymorphic_allocator<>(resource));
 			}
+			return std::move(*builder);
+		};
 
-			module_part = std::move(*builder);
-		});
+		// the elements of a braced list are evaluated in order, the builders after a failing one do not run
+		Container<Data_Modules...> container{ std::tuple<Data_Modules...>{ load(std::type_identity<Data_Modules>{}, members[I])... } };
 
-	return result;
+		if (error)
+			return Expected_Builder<Data_Modules...>::Make_Error(*error);
+		return Expected_Builder<Data_Modules...>::Make_Value(std::move(container));
+	}
+
+	template<class... Data_Modules>
+	auto Resource_Document_Builder(std::pmr::memory_resource* resource)
+	{
+		return [resource](const rapidjson::Value& doc) { return Build_From_JSON_Document_With_Resource<Data_Modules...>(doc, resource, std::index_sequence_for<Data_Modules...>{}); };
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
+	rapidjson::Document doc;
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Read_Mode mode)
+{
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, context.Acquire_Document(), context.Read_Buffer(), mode, Build_From_JSON_Document<Data_Modules...>);
 }
 
 template<class... Data_Modules>
-O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path)
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data)
 {
-	FILE* fp = std::fopen(path.generic_string().c_str(), "rb");
-	if (!fp)
-		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, doc, Build_From_JSON_Document<Data_Modules...>);
+}
 
-	static const std::size_t buffer_size = 64 * 1024;
-	std::unique_ptr<char[]> buffer(new char[buffer_size]);
-	rapidjson::FileReadStream is(fp, buffer.get(), buffer_size);
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Parse_Context& context)
+{
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, context.Acquire_Document(), Build_From_JSON_Document<Data_Modules...>);
+}
 
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Thread_Pool& pool, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
 	rapidjson::Document doc;
-	rapidjson::ParseResult r = doc.ParseStream<rapidjson::kParseDefaultFlags>(is);
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode, Detail::Parallel_Document_Builder<Data_Modules...>(pool));
+}
 
-	std::fclose(fp);
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Thread_Pool& pool, Read_Mode mode)
+{
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, context.Acquire_Document(), context.Read_Buffer(), mode, Detail::Parallel_Document_Builder<Data_Modules...>(pool));
+}
 
-	if (!r)
-		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Thread_Pool& pool)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, doc, Detail::Parallel_Document_Builder<Data_Modules...>(pool));
+}
 
-	return Build_From_JSON_Document<Data_Modules...>(doc);
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Parse_Context& context, Thread_Pool& pool)
+{
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, context.Acquire_Document(), Detail::Parallel_Document_Builder<Data_Modules...>(pool));
 }
 
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, std::pmr::memory_resource* resource)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, doc, Detail::Resource_Document_Builder<Data_Modules...>(resource));
+}
 
 template<class... Data_Modules>
-O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data)
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, std::pmr::memory_resource* resource, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
+	rapidjson::Document doc;
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode, Detail::Resource_Document_Builder<Data_Modules...>(resource));
+}
+
+template<class... Data_Modules, class Input_Stream>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_Stream(Input_Stream& is)
+{
+	return Build_From_JSON_Stream<Data_Modules...>(is, Default_Parse{});
+}
+
+template<class... Data_Modules, O::Configuration::Application::JSON_Parse_Policy Policy>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Policy)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>, Policy>(data, doc, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules, O::Configuration::Application::JSON_Parse_Policy Policy>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Parse_Context& context, Policy)
+{
+	return Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>, Policy>(data, context.Acquire_Document(), Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules, O::Configuration::Application::JSON_Parse_Policy Policy>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Policy, Read_Mode mode)
 {
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
 	rapidjson::Document doc;
-	rapidjson::ParseResult r =
-		doc.Parse<rapidjson::kParseDefaultFlags>(data.data(),
-			static_cast<rapidjson::SizeType>(data.size()));
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>, Policy>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules, O::Configuration::Application::JSON_Parse_Policy Policy>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Policy, Read_Mode mode)
+{
+	return Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>, Policy>(path, context.Acquire_Document(), context.Read_Buffer(), mode, Build_From_JSON_Document<Data_Modules...>);
+}
+
+template<class... Data_Modules, class Input_Stream, O::Configuration::Application::JSON_Parse_Policy Policy>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_Stream(Input_Stream& is, Policy)
+{
+	Expected_Builder<Data_Modules...> result = Expected_Builder<Data_Modules...>::Make_Value();
 
+	Detail::Stream_Handler<Data_Modules...> handler(result.Value());
+	rapidjson::Reader reader;
+	rapidjson::ParseResult r = reader.Parse<Policy::FLAGS & ~INSITU>(is, handler);
+
+	if (handler.Module_Error())
+		return Expected_Builder<Data_Modules...>::Make_Error(*handler.Module_Error());
+	if (handler.Root_Is_Not_An_Object())
+		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
 	if (!r)
-		return Expected_Builder<Data_Modules...>::Make_Error(
-			Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+		return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+	return result;
+}
+
+template<class... Data_Modules, O::Configuration::Application::Instrumentation_Policy Instrumentation>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_File(const std::filesystem::path& path, Parse_Context& context, Instrumentation& instrumentation, Read_Mode mode)
+{
+	std::size_t input_size = 0;
+	if constexpr (Instrumentation::ENABLED)
+	{
+		std::error_code ec;
+		input_size = static_cast<std::size_t>(std::filesystem::file_size(path, ec));
+		if (ec)
+			input_size = 0;
+	}
 
-	return Build_From_JSON_Document<Data_Modules...>(doc);
+	Detail::Instrumented_Document_Builder<Instrumentation, Data_Modules...> builder(instrumentation, input_size);
+	Expected_Builder<Data_Modules...> result = Detail::Parse_File_And_Build<Expected_Builder<Data_Modules...>>(path, context.Acquire_Document(), context.Read_Buffer(), mode, std::ref(builder));
+	builder.Report_Parse();
+	return result;
 }
 
+template<class... Data_Modules, O::Configuration::Application::Instrumentation_Policy Instrumentation>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_String(std::string_view data, Parse_Context& context, Instrumentation& instrumentation)
+{
+	Detail::Instrumented_Document_Builder<Instrumentation, Data_Modules...> builder(instrumentation, data.size());
+	Expected_Builder<Data_Modules...> result = Detail::Parse_String_And_Build<Expected_Builder<Data_Modules...>>(data, context.Acquire_Document(), std::ref(builder));
+	builder.Report_Parse();
+	return result;
+}
 
 #endif //CONFIGURATION_APPLICATION_JSON_BUILDER_HPP
@@ -0,0 +1,320 @@
+#ifndef CONFIGURATION_APPLICATION_JSON_STREAM_HANDLER_H
+#define CONFIGURATION_APPLICATION_JSON_STREAM_HANDLER_H
+
+// STL
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+#include "key_dispatch.h"
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief True when the builder derives from Module::JSON_SAX_Builder and accepts SAX events.
+	 */
+	template<class Builder>
+	concept SAX_Builder = requires { typename Builder::SAX_Handler; };
+
+	/**
+	 * @brief SAX handler rebuilding a single sub-tree as a rapidjson::Value.
+	 *
+	 * This is the fallback used to feed DOM-only builders from a stream: only the module's own value is allocated.
+	 */
+	class DOM_Adapter
+	{
+	public:
+		bool Null()                                                           { rapidjson::Value v;                      return Add(v); }
+		bool Bool(bool b)                                                     { rapidjson::Value v(b);                   return Add(v); }
+		bool Int(int i)                                                       { rapidjson::Value v(i);                   return Add(v); }
+		bool Uint(unsigned u)                                                 { rapidjson::Value v(u);                   return Add(v); }
+		bool Int64(std::int64_t i)                                            { rapidjson::Value v(i);                   return Add(v); }
+		bool Uint64(std::uint64_t u)                                          { rapidjson::Value v(u);                   return Add(v); }
+		bool Double(double d)                                                 { rapidjson::Value v(d);                   return Add(v); }
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool)     { rapidjson::Value v(str, length, allocator); return Add(v); }
+		bool String(const char* str, rapidjson::SizeType length, bool)        { rapidjson::Value v(str, length, allocator); return Add(v); }
+		bool Key(const char* str, rapidjson::SizeType length, bool)           { keys.emplace_back(str, length, allocator); return true; }
+		bool StartObject()                                                    { stack.emplace_back(rapidjson::kObjectType); return true; }
+		bool StartArray()                                                     { stack.emplace_back(rapidjson::kArrayType);  return true; }
+		bool EndObject(rapidjson::SizeType)                                   { return Close(); }
+		bool EndArray(rapidjson::SizeType)                                    { return Close(); }
+
+		/**
+		 * @brief The rebuilt value, valid once the last event was received.
+		 */
+		const rapidjson::Value& Root() const noexcept
+		{
+			return root;
+		}
+
+	private:
+		bool Close()
+		{
+			rapidjson::Value v(std::move(stack.back()));
+			stack.pop_back();
+			return Add(v);
+		}
+
+		bool Add(rapidjson::Value& v)
+		{
+			if (stack.empty())
+				root = v;
+			else if (stack.back().IsObject())
+			{
+				stack.back().AddMember(keys.back(), v, allocator);
+				keys.pop_back();
+			}
+			else
+				stack.back().PushBack(v, allocator);
+			return true;
+		}
+
+		rapidjson::MemoryPoolAllocator<> allocator;
+		std::vector<rapidjson::Value> stack;
+		std::vector<rapidjson::Value> keys;
+		rapidjson::Value root;
+	};
+
+	/**
+	 * @brief Receives the events of one module value and runs the module builder.
+	 *
+	 * SAX builders are fed directly, other builders go through a DOM_Adapter and get Load_From_JSON called once the value is complete.
+	 */
+	template<class Data>
+	class Module_Sink
+	{
+		using Builder = typename O::Configuration::Module::Traits<Data>::Builder;
+
+	public:
+		/**
+		 * @brief Call fn with the handler receiving this module's events.
+		 */
+		template<class Fn>
+		bool Forward(Fn&& fn)
+		{
+			if constexpr (SAX_Builder<Builder>)
+				return fn(static_cast<typename Builder::SAX_Handler&>(builder));
+			else
+				return fn(adapter);
+		}
+
+		/**
+		 * @brief Run the end of the build once the module value is complete.
+		 *
+		 * @return std::optional<int> the module error id on failure.
+		 */
+		std::optional<int> Finish()
+		{
+			std::optional<int> error;
+			if constexpr (SAX_Builder<Builder>)
+			{
+				if (auto opt = builder.End_SAX())
+					error = static_cast<int>(*opt);
+			}
+			else
+			{
+				if (auto opt = builder.Load_From_JSON(adapter.Root()))
+					error = static_cast<int>(*opt);
+			}
+			return error;
+		}
+
+		/**
+		 * @brief Move-out the built data.
+		 */
+		Data&& operator*()
+		{
+			return *builder;
+		}
+
+	private:
+		struct Empty {};
+
+		Builder builder;
+		[[no_unique_address]] std::conditional_t<SAX_Builder<Builder>, Empty, DOM_Adapter> adapter;
+	};
+
+	/**
+	 * @brief Root SAX handler dispatching each top-level key to its module sink.
+	 *
+	 * Values of unknown keys (and repeated keys, the first occurrence wins like in the DOM path) are skipped by depth counting without being stored.
+	 */
+	template<class... Data_Modules>
+	class Stream_Handler
+	{
+		static constexpr std::size_t NO_MODULE = sizeof...(Data_Modules);
+
+	public:
+		explicit Stream_Handler(Container<Data_Modules...>& container) :
+			container(container)
+		{
+		}
+
+		bool Null()                                                        { return Scalar([&](auto& h) { return h.Null(); }); }
+		bool Bool(bool b)                                                  { return Scalar([&](auto& h) { return h.Bool(b); }); }
+		bool Int(int i)                                                    { return Scalar([&](auto& h) { return h.Int(i); }); }
+		bool Uint(unsigned u)                                              { return Scalar([&](auto& h) { return h.Uint(u); }); }
+		bool Int64(std::int64_t i)                                         { return Scalar([&](auto& h) { return h.Int64(i); }); }
+		bool Uint64(std::uint64_t u)                                       { return Scalar([&](auto& h) { return h.Uint64(u); }); }
+		bool Double(double d)                                              { return Scalar([&](auto& h) { return h.Double(d); }); }
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool c){ return Scalar([&](auto& h) { return h.RawNumber(str, length, c); }); }
+		bool String(const char* str, rapidjson::SizeType length, bool c)   { return Scalar([&](auto& h) { return h.String(str, length, c); }); }
+
+		bool Key(const char* str, rapidjson::SizeType length, bool copy)
+		{
+			if (depth > 1)
+				return Forward([&](auto& h) { return h.Key(str, length, copy); });
+
+			std::size_t index = Key_Table<Data_Modules...>::Find(std::string_view(str, length));
+			if (index != NO_MODULE && !seen[index])
+			{
+				seen[index] = true;
+				Emplace_Sink(index, std::index_sequence_for<Data_Modules...>{});
+			}
+			return true;
+		}
+
+		bool StartObject()
+		{
+			if (depth++ == 0)
+				return true;
+			return Forward([](auto& h) { return h.StartObject(); });
+		}
+
+		bool StartArray()
+		{
+			if (depth++ == 0)
+				return Fail_Root();
+			return Forward([](auto& h) { return h.StartArray(); });
+		}
+
+		bool EndObject(rapidjson::SizeType count)
+		{
+			if (--depth == 0)
+				return true;
+			return Forward([&](auto& h) { return h.EndObject(count); }) && Complete_If_Done();
+		}
+
+		bool EndArray(rapidjson::SizeType count)
+		{
+			--depth;
+			return Forward([&](auto& h) { return h.EndArray(count); }) && Complete_If_Done();
+		}
+
+		/**
+		 * @brief Error raised by a module builder, if any.
+		 */
+		const std::optional<Error>& Module_Error() const noexcept
+		{
+			return module_error;
+		}
+
+		/**
+		 * @brief True when the document root was not an object.
+		 */
+		bool Root_Is_Not_An_Object() const noexcept
+		{
+			return root_error;
+		}
+
+	private:
+		template<class Fn>
+		bool Scalar(Fn&& fn)
+		{
+			if (depth == 0)
+				return Fail_Root();
+			return Forward(std::forward<Fn>(fn)) && Complete_If_Done();
+		}
+
+		template<class Fn>
+		bool Forward(Fn&& fn)
+		{
+			return std::visit([&](auto& sink) -> bool
+				{
+					if constexpr (std::is_same_v<std::decay_t<decltype(sink)>, std::monostate>)
+						return true;
+					else
+					{
+						if (sink.Forward(fn))
+							return true;
+						// a SAX builder stopped the stream, report its error rather than a parse failure
+						if (auto error_id = sink.Finish())
+							module_error = Error{ Sink_Key(sink), *error_id };
+						return false;
+					}
+				}, active);
+		}
+
+		bool Complete_If_Done()
+		{
+			if (depth != 1)
+				return true;
+
+			return std::visit([&](auto& sink) -> bool
+				{
+					using Sink = std::decay_t<decltype(sink)>;
+					if constexpr (std::is_same_v<Sink, std::monostate>)
+						return true;
+					else
+					{
+						if (auto error_id = sink.Finish())
+						{
+							module_error = Error{ Sink_Key(sink), *error_id };
+							return false;
+						}
+						Store(sink);
+						active.template emplace<0>();
+						return true;
+					}
+				}, active);
+		}
+
+		template<class Data>
+		static const char* Sink_Key(Module_Sink<Data>&) noexcept
+		{
+			return O::Configuration::Module::Traits<Data>::Builder::Key();
+		}
+
+		template<class Data>
+		void Store(Module_Sink<Data>& sink)
+		{
+			std::get<Data>(container.modules) = *sink;
+		}
+
+		template<std::size_t... Is>
+		void Emplace_Sink(std::size_t index, std::index_sequence<Is...>)
+		{
+			((index == Is ? (active.template emplace<Is + 1>(), void()) : void()), ...);
+		}
+
+		bool Fail_Root()
+		{
+			root_error = true;
+			return false;
+		}
+
+		Container<Data_Modules...>& container;
+		std::variant<std::monostate, Module_Sink<Data_Modules>...> active;
+		std::array<bool, sizeof...(Data_Modules)> seen{};
+		std::optional<Error> module_error;
+		std::size_t depth = 0;
+		bool root_error = false;
+	};
+
+} // namespace O::Configuration::Application::Detail
+
+#endif //CONFIGURATION_APPLICATION_JSON_STREAM_HANDLER_H
@@ -0,0 +1,62 @@
+#ifndef CONFIGURATION_APPLICATION_JSON_VALIDATOR_H
+#define CONFIGURATION_APPLICATION_JSON_VALIDATOR_H
+
+// STL
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+// APPLICATION
+#include "json_builder.h"
+#include "parse_context.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Check a JSON file the way Build_From_JSON_File does, without building the Container.
+	 *
+	 * Each module present in the file is checked by the Validate_JSON hook of its builder, the modules data are never moved into a Container.
+	 * The reported error is the one Build_From_JSON_File would return.
+	 *
+	 * @tparam Data_Modules List of module data types to check.
+	 * @param path Path to the JSON file to check.
+	 * @param mode How the file is read.
+	 * @return std::optional<Error> - std::nullopt when the file would build, otherwise the error.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Validate_JSON_File(const std::filesystem::path& path, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Same as Validate_JSON_File, reusing the Document pools and read buffer of context.
+	 *
+	 * Checking many files with one context makes no heap allocation in rapidjson once the pools fit the largest file.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Validate_JSON_File(const std::filesystem::path& path, Parse_Context& context, Read_Mode mode = Read_Mode::STREAM);
+
+	/**
+	 * @brief Check an in-memory JSON string the way Build_From_JSON_String does, without building the Container.
+	 *
+	 * @tparam Data_Modules List of module data types to check.
+	 * @param data JSON text to check.
+	 * @return std::optional<Error> - std::nullopt when the string would build, otherwise the error.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Validate_JSON_String(std::string_view data);
+
+	/**
+	 * @brief Same as Validate_JSON_String, reusing the Document pools of context.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Validate_JSON_String(std::string_view data, Parse_Context& context);
+
+	/**
+	 * @brief Check an already parsed document, the root must be an object holding the module keys.
+	 */
+	template<class... Data_Modules>
+	std::optional<Error> Validate_JSON_Document(const rapidjson::Value& doc);
+} // namespace O::Configuration::Application
+
+#include "json_validator.hpp"
+
+#endif //CONFIGURATION_APPLICATION_JSON_VALIDATOR_H
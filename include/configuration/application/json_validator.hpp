@@ -0,0 +1,99 @@
+#ifndef CONFIGURATION_APPLICATION_JSON_VALIDATOR_HPP
+#define CONFIGURATION_APPLICATION_JSON_VALIDATOR_HPP
+
+// STL
+#include <array>
+#include <memory>
+#include <span>
+#include <utility>
+
+// APPLICATION
+#include "json_builder.h"
+#include "json_validator.h"
+#include "parse_context.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Result type handed to Parse_File_And_Build and Parse_String_And_Build by the validation entry points.
+	 */
+	struct Validation_Result
+	{
+		std::optional<Error> error;
+
+		static Validation_Result Make_Error(Error e) { return Validation_Result{ e }; }
+	};
+
+	/**
+	 * @brief Run the Validate_JSON hook of the builder of Data on value.
+	 */
+	template<class Data>
+	std::optional<Error> Validate_Module(const rapidjson::Value& value)
+	{
+		using Builder = typename O::Configuration::Module::Traits<Data>::Builder;
+
+		Builder builder;
+		if (auto opt = builder.Validate_JSON(value))
+			return Error{ Builder::Key(), static_cast<int>(*opt) };
+		return std::nullopt;
+	}
+
+	template<class... Data_Modules, std::size_t... I>
+	std::optional<Error> Validate_Members(const rapidjson::Value& doc, const std::array<rapidjson::Value::ConstMemberIterator, sizeof...(Data_Modules)>& members, std::index_sequence<I...>)
+	{
+		// module order, stops at the first error as Build_From_JSON_Document does
+		std::optional<Error> error;
+		(void)((members[I] != doc.MemberEnd() && (error = Validate_Module<Data_Modules>(members[I]->value))) || ...);
+		return error;
+	}
+
+	template<class... Data_Modules>
+	Validation_Result Validate_Root(const rapidjson::Value& doc)
+	{
+		return Validation_Result{ Validate_JSON_Document<Data_Modules...>(doc) };
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_Document(const rapidjson::Value& doc)
+{
+	if (!doc.IsObject())
+		return Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) };
+
+	return Detail::Validate_Members<Data_Modules...>(doc, Detail::Find_Module_Members<Data_Modules...>(doc), std::index_sequence_for<Data_Modules...>{});
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_File(const std::filesystem::path& path, Read_Mode mode)
+{
+	std::unique_ptr<char[]> buffer = Detail::Make_Read_Buffer(mode);
+	rapidjson::Document doc;
+	return Detail::Parse_File_And_Build<Detail::Validation_Result>(path, doc, std::span<char>(buffer.get(), buffer ? Parse_Context::READ_BUFFER_SIZE : 0), mode, Detail::Validate_Root<Data_Modules...>).error;
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_File(const std::filesystem::path& path, Parse_Context& context, Read_Mode mode)
+{
+	return Detail::Parse_File_And_Build<Detail::Validation_Result>(path, context.Acquire_Document(), context.Read_Buffer(), mode, Detail::Validate_Root<Data_Modules...>).error;
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_String(std::string_view data)
+{
+	rapidjson::Document doc;
+	return Detail::Parse_String_And_Build<Detail::Validation_Result>(data, doc, Detail::Validate_Root<Data_Modules...>).error;
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Validate_JSON_String(std::string_view data, Parse_Context& context)
+{
+	return Detail::Parse_String_And_Build<Detail::Validation_Result>(data, context.Acquire_Document(), Detail::Validate_Root<Data_Modules...>).error;
+}
+
+#endif //CONFIGURATION_APPLICATION_JSON_VALIDATOR_HPP
@@ -3,41 +3,72 @@
 
 // STL
 #include <tuple>
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
+#include <string>
+#include <vector>
 
 // UTILS
 #include <utils/expected.h>
 
 // APPLICATION
 #include "container.h"
+#include "instrumentation.h"
+#include "output_sink.h"
 
 namespace O::Configuration::Application
 {
 	/**
-	 * @brief Errors returned when writing configuration to a file.
-	 *
-	 * FILE_OPEN_FAILED - Could not open target file for writing.
-	 * FILE_WRITE_FAILED - Generic failure writing to the file (disk full, etc).
+	 * @brief How Write_As_JSON_File writes the file.
 	 */
-	enum class Write_Error {
-		FILE_OPEN_FAILED,
-		FILE_WRITE_FAILED
+	struct File_Write_Options
+	{
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+		std::size_t buffer_size = DEFAULT_BUFFER_SIZE; /**< Bytes gathered before each write call, a document up to this size is written with a single call. */
+		bool atomic = false;                           /**< Write a temporary file next to the destination, fsync it once and rename it over the destination. */
 	};
 
 	/**
 	 * @brief Write a container to a JSON file.
 	 *
 	 * Iterates the container's modules and invokes each module's Writer to serialize its data. 
-	 * Returns std::nullopt on success or a Write_Error on failure.
+	 * Returns std::nullopt on success or a Write_Error on failure, failures to write, sync or close the file included.
+	 * With options.atomic readers of filepath see either the previous file or the complete new one, never a partial write.
 	 *
 	 * @tparam Data_Modules module data types in the container.
 	 * @param data the container to serialize.
 	 * @param filepath the destination filesystem path.
+	 * @param options buffer size and atomic mode.
 	 * @return std::optional<Write_Error> - std::nullopt on success, otherwise the error.
 	 */
 	template<class... Data_Modules>
-	std::optional<Write_Error> Write_As_JSON_File(const Container<Data_Modules...>& data, const std::filesystem::path& filepath);
+	std::optional<Write_Error> Write_As_JSON_File(const Container<Data_Modules...>& data, const std::filesystem::path& filepath, const File_Write_Options& options = {});
+
+	/**
+	 * @brief Same as Write_As_JSON_File, reporting the To_JSON of each module to instrumentation.
+	 *
+	 * @tparam Instrumentation Policy receiving the steps, Trace_Recorder or No_Instrumentation.
+	 */
+	template<class... Data_Modules, Instrumentation_Policy Instrumentation>
+	std::optional<Write_Error> Write_As_JSON_File(const Container<Data_Modules...>& data, const std::filesystem::path& filepath, const File_Write_Options& options, Instrumentation& instrumentation);
+
+	/**
+	 * @brief Write a container to a sink (Fd_Sink, File_Sink, Ring_Buffer_Sink or any type with the same Write member).
+	 *
+	 * The document is gathered in a buffer of buffer_size bytes, the sink receives one Write call per full buffer and one for the rest.
+	 *
+	 * @tparam Data_Modules module data types in the container.
+	 * @tparam Sink destination type, see output_sink.h.
+	 * @param data the container to serialize.
+	 * @param sink the destination.
+	 * @param buffer_size size of the write buffer in bytes.
+	 * @return std::optional<Write_Error> - std::nullopt on success, otherwise the first error returned by the sink.
+	 */
+	template<class... Data_Modules, class Sink>
+	std::optional<Write_Error> Write_As_JSON_Stream(const Container<Data_Modules...>& data, Sink& sink, std::size_t buffer_size = File_Write_Options::DEFAULT_BUFFER_SIZE);
 
 	/**
 	 * @brief Serialize a container to an in-memory JSON string.
@@ -51,6 +82,55 @@ namespace O::Configuration::Application
 	template<class... Data_Modules>
 	std::string Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas);
 
+	/**
+	 * @brief Serialize a container into a caller provided string, replacing its content.
+	 *
+	 * The document is written in place: the capacity of out is reused, so serializing into the same string again allocates nothing once it is large enough.
+	 *
+	 * @tparam Data_Modules module data types in the final application container.
+	 * @param datas The container to serialize.
+	 * @param out Receives the JSON document (UTF-8).
+	 */
+	template<class... Data_Modules>
+	void Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::string& out);
+
+	/**
+	 * @brief Same as the std::string overload, reporting the To_JSON of each module to instrumentation.
+	 *
+	 * @tparam Instrumentation Policy receiving the steps, Trace_Recorder or No_Instrumentation.
+	 */
+	template<class... Data_Modules, Instrumentation_Policy Instrumentation>
+	void Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::string& out, Instrumentation& instrumentation);
+
+	/**
+	 * @brief Same as the std::string overload, out is not null terminated.
+	 */
+	template<class... Data_Modules>
+	void Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::vector<char>& out);
+
+	/**
+	 * @brief Serialize a container into a fixed buffer, never allocating the output.
+	 *
+	 * @tparam Data_Modules module data types in the final application container.
+	 * @param datas The container to serialize.
+	 * @param out Buffer receiving the JSON document, not null terminated.
+	 * @return O::Expected<std::size_t, Write_Error> - the number of bytes written, or BUFFER_TOO_SMALL when out cannot hold the document (its content is then unspecified, Measure_JSON_Size gives the size needed).
+	 */
+	template<class... Data_Modules>
+	O::Expected<std::size_t, Write_Error> Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::span<char> out);
+
+	/**
+	 * @brief Exact size in bytes of the JSON document written for a container.
+	 *
+	 * The modules are serialized into a counter without storing anything, call it to reserve the output once when its size is not known in advance.
+	 *
+	 * @tparam Data_Modules module data types in the final application container.
+	 * @param datas The container to measure.
+	 * @return std::size_t - size of the document written by Write_As_JSON_String.
+	 */
+	template<class... Data_Modules>
+	std::size_t Measure_JSON_Size(const O::Configuration::Application::Container<Data_Modules...>& datas);
+
 } // namespace O::Configuration::Application
 
 #include "json_writer.hpp"
@@ -2,77 +2,285 @@
 #define CONFIGURATION_APPLICATION_JSON_WRITER_HPP
 
 // STL
+#include <algorithm>
+#include <memory>
 #include <optional>
-#include <fstream>
+#include <span>
 #include <string>
 #include <system_error>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // APPLICATION
 #include "container.h"
 #include "json_writer.h"
 
+// MODULE
+#include "configuration/module/traits.h"
+
 // UTILS
 #include <utils/tuple_helper.h>
 
 // RAPIDJSON
 #include <rapidjson/document.h>
-#include <rapidjson/filewritestream.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
-template<class... Data_Modules>
-std::optional<O::Configuration::Application::Write_Error>
-O::Configuration::Application::Write_As_JSON_File(
-    const O::Configuration::Application::Container<Data_Modules...>& datas,
-    const std::filesystem::path& filepath)
+namespace O::Configuration::Application::Detail
+{
+    /**
+     * @brief rapidjson output stream appending to a std::string or std::vector<char>.
+     */
+    template<class Chars>
+    class Chars_Sink
+    {
+    public:
+        using Ch = char;
+
+        explicit Chars_Sink(Chars& out) : out(out) {}
+
+        void Put(char c) { out.push_back(c); }
+        void Flush() {}
+
+    private:
+        Chars& out;
+    };
+
+    /**
+     * @brief rapidjson output stream writing into a fixed buffer, the characters past its end are counted and dropped.
+     */
+    class Span_Sink
+    {
+    public:
+        using Ch = char;
+
+        explicit Span_Sink(std::span<char> out) : out(out) {}
+
+        void Put(char c)
+        {
+            if (size < out.size())
+                out[size] = c;
+            ++size;
+        }
+        void Flush() {}
+
+        std::size_t Size() const noexcept { return size; }
+
+    private:
+        std::span<char> out;
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief rapidjson output stream only counting the characters.
+     */
+    class Counting_Sink
+    {
+    public:
+        using Ch = char;
+
+        void Put(char) { ++size; }
+        void Flush() {}
+
+        std::size_t Size() const noexcept { return size; }
+
+    private:
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief rapidjson output stream forwarding to another one and counting the characters, used to report the size of each module write.
+     */
+    template<class Output_Stream>
+    class Counted_Stream
+    {
+    public:
+        using Ch = char;
+
+        explicit Counted_Stream(Output_Stream& os) : os(os) {}
+
+        void Put(char c) { os.Put(c); ++size; }
+        void Flush() { os.Flush(); }
+
+        std::size_t Size() const noexcept { return size; }
+
+    private:
+        Output_Stream& os;
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief Write the root object holding every module of datas into os, reporting the To_JSON of each module to instrumentation.
+     */
+    template<class Output_Stream, class Instrumentation, class... Data_Modules>
+    void Write_Modules(Output_Stream& os, const O::Configuration::Application::Container<Data_Modules...>& datas, Instrumentation& instrumentation)
+    {
+        // the size of each module is only counted when someone records it
+        using Stream = std::conditional_t<Instrumentation::ENABLED, Counted_Stream<Output_Stream>, Output_Stream&>;
+        Stream stream(os);
+
+        // the writer level stack starts in this buffer, only documents nested deeper than about 32 levels reach the heap
+        char stack_buffer[1024];
+        rapidjson::MemoryPoolAllocator<> stack_allocator(stack_buffer, sizeof(stack_buffer));
+        rapidjson::Writer<std::remove_reference_t<Stream>, rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>> writer(stream, &stack_allocator);
+
+        writer.StartObject();
+
+        O::For_Each_In_Tuple(datas.modules, [&](auto const& module_part) {
+            using Module_T = std::decay_t<decltype(module_part)>;
+            using WriterT  = typename O::Configuration::Module::Traits<Module_T>::Writer;
+
+            WriterT module_writer;
+
+            writer.Key(WriterT::Key());
+
+            auto scope = instrumentation.Begin();
+            if constexpr (Instrumentation::ENABLED)
+            {
+                const std::size_t before = stream.Size();
+                module_writer.To_JSON(writer, module_part);
+                instrumentation.End(scope, Phase::WRITE, WriterT::Key(), stream.Size() - before);
+            }
+            else
+                module_writer.To_JSON(writer, module_part);
+        });
+
+        writer.EndObject();
+    }
+
+    /**
+     * @brief Write the root object holding every module of datas into os.
+     */
+    template<class Output_Stream, class... Data_Modules>
+    void Write_Modules(Output_Stream& os, const O::Configuration::Application::Container<Data_Modules...>& datas)
+    {
+        No_Instrumentation instrumentation;
+        Write_Modules(os, datas, instrumentation);
+    }
+} // namespace O::Configuration::Application::Detail
+
+namespace O::Configuration::Application::Detail
 {
-    FILE* fp = std::fopen(filepath.string().c_str(), "wb");
-    if (!fp)
-        return Write_Error::FILE_OPEN_FAILED;
+    /**
+     * @brief Call write with a buffered stream of buffer_size bytes over sink, return the first error of the sink.
+     */
+    template<class Sink, class Write>
+    std::optional<Write_Error> Write_Stream(Sink& sink, std::size_t buffer_size, Write&& write)
+    {
+        buffer_size = std::max<std::size_t>(buffer_size, 1);
+        std::unique_ptr<char[]> buffer(new char[buffer_size]);
 
-    char buffer[65536];
-    rapidjson::FileWriteStream os(fp, buffer, sizeof(buffer));
-    rapidjson::Writer<rapidjson::FileWriteStream> writer(os);
+        Buffered_Stream<Sink> os(sink, std::span<char>(buffer.get(), buffer_size));
+        write(os);
+        os.Flush();
+        return os.Error();
+    }
 
-    writer.StartObject();
+    /**
+     * @brief Create filepath as described by options and call write with a buffered stream over it.
+     */
+    template<class Write>
+    std::optional<Write_Error> Write_File(const std::filesystem::path& filepath, const File_Write_Options& options, Write&& write)
+    {
+        const std::filesystem::path target = options.atomic ? Temporary_Path(filepath) : filepath;
 
-    O::For_Each_In_Tuple(datas.modules, [&](auto const& module_part) {
-        using Module_T = std::decay_t<decltype(module_part)>;
-        using WriterT  = typename O::Configuration::Module::Traits<Module_T>::Writer;
+        const int fd = Open_For_Writing(target);
+        if (fd < 0)
+            return Write_Error::FILE_OPEN_FAILED;
 
-        WriterT module_writer;
+        Fd_Sink sink(fd);
+        std::optional<Write_Error> error = Write_Stream(sink, options.buffer_size, std::forward<Write>(write));
 
-        writer.Key(WriterT::Key());
-        module_writer.To_JSON(writer, module_part);
-    });
+        // the only fsync of the atomic mode, the rename must not publish data still in the page cache
+        if (!Close_File(fd, options.atomic && !error) && !error)
+            error = Write_Error::FILE_WRITE_FAILED;
 
-    writer.EndObject();
+        if (options.atomic)
+        {
+            std::error_code ec;
+            if (!error)
+            {
+                std::filesystem::rename(target, filepath, ec);
+                if (ec)
+                    error = Write_Error::FILE_WRITE_FAILED;
+            }
+            if (error)
+                std::filesystem::remove(target, ec);
+        }
+        return error;
+    }
+} // namespace O::Configuration::Application::Detail
 
-    std::fclose(fp);
-    return std::nullopt; // success
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Write_Error>
+O::Configuration::Application::Write_As_JSON_File(
+    const O::Configuration::Application::Container<Data_Modules...>& datas,
+    const std::filesystem::path& filepath,
+    const File_Write_Options& options)
+{
+    return Detail::Write_File(filepath, options, [&](auto& os) { Detail::Write_Modules(os, datas); });
+}
+
+template<class... Data_Modules, O::Configuration::Application::Instrumentation_Policy Instrumentation>
+std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Write_As_JSON_File(const O::Configuration::Application::Container<Data_Modules...>& datas, const std::filesystem::path& filepath, const File_Write_Options& options, Instrumentation& instrumentation)
+{
+    return Detail::Write_File(filepath, options, [&](auto& os) { Detail::Write_Modules(os, datas, instrumentation); });
+}
+
+template<class... Data_Modules, class Sink>
+std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Write_As_JSON_Stream(const O::Configuration::Application::Container<Data_Modules...>& datas, Sink& sink, std::size_t buffer_size)
+{
+    return Detail::Write_Stream(sink, buffer_size, [&](auto& os) { Detail::Write_Modules(os, datas); });
 }
 
 template<class... Data_Modules>
 std::string O::Configuration::Application::Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas)
 {
-    rapidjson::StringBuffer sb;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    std::string json;
+    Write_As_JSON_String(datas, json);
+    return json;
+}
 
-    writer.StartObject();
+template<class... Data_Modules>
+void O::Configuration::Application::Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::string& out)
+{
+    out.clear();
+    Detail::Chars_Sink<std::string> os(out);
+    Detail::Write_Modules(os, datas);
+}
 
-    O::For_Each_In_Tuple(datas.modules, [&](auto const& module_part) {
-        using Module_T = std::decay_t<decltype(module_part)>;
-        using WriterT  = typename O::Configuration::Module::Traits<Module_T>::Writer;
+template<class... Data_Modules, O::Configuration::Application::Instrumentation_Policy Instrumentation>
+void O::Configuration::Application::Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::string& out, Instrumentation& instrumentation)
+{
+    out.clear();
+    Detail::Chars_Sink<std::string> os(out);
+    Detail::Write_Modules(os, datas, instrumentation);
+}
 
-        WriterT module_writer;
+template<class... Data_Modules>
+void O::Configuration::Application::Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::vector<char>& out)
+{
+    out.clear();
+    Detail::Chars_Sink<std::vector<char>> os(out);
+    Detail::Write_Modules(os, datas);
+}
 
-        writer.Key(WriterT::Key());
-        module_writer.To_JSON(writer, module_part);
-    });
+template<class... Data_Modules>
+O::Expected<std::size_t, O::Configuration::Application::Write_Error> O::Configuration::Application::Write_As_JSON_String(const O::Configuration::Application::Container<Data_Modules...>& datas, std::span<char> out)
+{
+    Detail::Span_Sink os(out);
+    Detail::Write_Modules(os, datas);
+    if (os.Size() > out.size())
+        return O::Expected<std::size_t, Write_Error>::Make_Error(Write_Error::BUFFER_TOO_SMALL);
+    return O::Expected<std::size_t, Write_Error>::Make_Value(os.Size());
+}
 
-    writer.EndObject();
-    return sb.GetString();
+template<class... Data_Modules>
+std::size_t O::Configuration::Application::Measure_JSON_Size(const O::Configuration::Application::Container<Data_Modules...>& datas)
+{
+    Detail::Counting_Sink os;
+    Detail::Write_Modules(os, datas);
+    return os.Size();
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,172 @@
+#ifndef CONFIGURATION_APPLICATION_KEY_DISPATCH_H
+#define CONFIGURATION_APPLICATION_KEY_DISPATCH_H
+
+// STL
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// MODULE
+#include "configuration/module/traits.h"
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief 64 bits FNV-1a hash of a string, usable at compile time.
+	 */
+	constexpr std::uint64_t Hash_Key(std::string_view key) noexcept
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (char c : key)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	/**
+	 * @brief Finalizer of splitmix64, used to derive a slot from a key hash and a displacement seed.
+	 */
+	constexpr std::uint64_t Mix(std::uint64_t value) noexcept
+	{
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+		return value ^ (value >> 31);
+	}
+
+	/**
+	 * @brief Slot table of a perfect hash over COUNT keys.
+	 *
+	 * Keys are split in COUNT buckets by their hash, each bucket holds the displacement seed that places all its keys in free slots.
+	 */
+	template<std::size_t COUNT>
+	struct Key_Layout
+	{
+		static constexpr std::size_t BUCKETS = COUNT == 0 ? 1 : COUNT;
+		static constexpr std::size_t SIZE = std::bit_ceil(2 * COUNT == 0 ? std::size_t(1) : 2 * COUNT);
+
+		static constexpr std::size_t Slot(std::uint64_t hash, std::uint64_t seed) noexcept
+		{
+			return static_cast<std::size_t>(Mix(hash + seed * 0x9e3779b97f4a7c15ull) & (SIZE - 1));
+		}
+
+		std::array<std::uint64_t, BUCKETS> seeds{};
+		std::array<std::size_t, SIZE> slots{};
+		bool complete = true;
+	};
+
+	/**
+	 * @brief True when no key appears twice.
+	 */
+	template<std::size_t COUNT>
+	constexpr bool Has_Unique_Keys(const std::array<std::string_view, COUNT>& keys) noexcept
+	{
+		for (std::size_t i = 0; i < COUNT; ++i)
+			for (std::size_t j = i + 1; j < COUNT; ++j)
+				if (keys[i] == keys[j])
+					return false;
+		return true;
+	}
+
+	/**
+	 * @brief Build the perfect hash layout with hash-and-displace, largest buckets first.
+	 */
+	template<std::size_t COUNT>
+	constexpr Key_Layout<COUNT> Make_Key_Layout(const std::array<std::string_view, COUNT>& keys) noexcept
+	{
+		using Layout = Key_Layout<COUNT>;
+		constexpr std::uint64_t MAX_SEED = 1u << 20;
+
+		Layout result;
+		for (std::size_t& slot : result.slots)
+			slot = COUNT;
+
+		std::array<std::uint64_t, COUNT + 1> hashes{};
+		std::array<std::size_t, Layout::BUCKETS> bucket_size{};
+		for (std::size_t i = 0; i < COUNT; ++i)
+		{
+			hashes[i] = Hash_Key(keys[i]);
+			++bucket_size[hashes[i] % Layout::BUCKETS];
+		}
+
+		std::array<bool, Layout::BUCKETS> placed{};
+		for (std::size_t round = 0; round < Layout::BUCKETS; ++round)
+		{
+			std::size_t bucket = Layout::BUCKETS;
+			for (std::size_t b = 0; b < Layout::BUCKETS; ++b)
+				if (!placed[b] && (bucket == Layout::BUCKETS || bucket_size[b] > bucket_size[bucket]))
+					bucket = b;
+			placed[bucket] = true;
+			if (bucket_size[bucket] == 0)
+				continue;
+
+			bool found = false;
+			for (std::uint64_t seed = 0; seed < MAX_SEED && !found; ++seed)
+			{
+				std::array<std::size_t, Layout::SIZE> candidate = result.slots;
+				found = true;
+				for (std::size_t i = 0; i < COUNT && found; ++i)
+				{
+					if (hashes[i] % Layout::BUCKETS != bucket)
+						continue;
+					std::size_t slot = Layout::Slot(hashes[i], seed);
+					if (candidate[slot] != COUNT)
+						found = false;
+					else
+						candidate[slot] = i;
+				}
+				if (found)
+				{
+					result.slots = candidate;
+					result.seeds[bucket] = seed;
+				}
+			}
+			if (!found)
+				result.complete = false;
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Compile-time perfect hash over the Key() of every module builder.
+	 *
+	 * @tparam Data_Modules the module data types of the Container.
+	 *
+	 * A lookup costs one pass over the key, two table reads and one string comparison.
+	 * Two modules using the same Key() fail to compile.
+	 */
+	template<class... Data_Modules>
+	class Key_Table
+	{
+	public:
+		/// Number of modules, also returned by Find when the key matches no module.
+		static constexpr std::size_t COUNT = sizeof...(Data_Modules);
+
+		/**
+		 * @brief Return the index of the module using this key, or COUNT.
+		 */
+		static constexpr std::size_t Find(std::string_view key) noexcept
+		{
+			using Layout = Key_Layout<COUNT>;
+
+			const std::uint64_t hash = Hash_Key(key);
+			const std::size_t index = layout.slots[Layout::Slot(hash, layout.seeds[hash % Layout::BUCKETS])];
+			if (index != COUNT && keys[index] == key)
+				return index;
+			return COUNT;
+		}
+
+	private:
+		static constexpr std::array<std::string_view, COUNT> keys = { std::string_view(O::Configuration::Module::Traits<Data_Modules>::Builder::Key())... };
+		static_assert(Has_Unique_Keys(keys), "Two modules of the Container use the same JSON Key()");
+
+		static constexpr Key_Layout<COUNT> layout = Make_Key_Layout(keys);
+		static_assert(layout.complete, "Could not build a perfect hash over the module keys");
+	};
+
+} // namespace O::Configuration::Application::Detail
+
+#endif //CONFIGURATION_APPLICATION_KEY_DISPATCH_H
@@ -0,0 +1,105 @@
+#ifndef CONFIGURATION_APPLICATION_LAYERED_BUILDER_H
+#define CONFIGURATION_APPLICATION_LAYERED_BUILDER_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <unordered_map>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "json_builder.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Parsed layers of Build_From_JSON_Layers, kept between builds so only the layers that changed are parsed again.
+	 *
+	 * A layer is reused without being read while its modification time and size are unchanged.
+	 * Otherwise the file is mapped and hashed: when the content hash matches the cached one only the stamp is updated, else the layer is parsed again.
+	 *
+	 * @note A rewrite keeping the size within the modification time resolution of the file system is not seen, as with the polling of Live_Configuration.
+	 * @note A cache is not thread safe and the Documents it hands out are only valid until the next Load of the same path.
+	 */
+	class Layer_Cache
+	{
+	public:
+		using Expected_Layer = O::Expected<const rapidjson::Document*, Error>;
+
+		Layer_Cache() = default;
+		Layer_Cache(const Layer_Cache&) = delete;
+		Layer_Cache& operator=(const Layer_Cache&) = delete;
+
+		/**
+		 * @brief Return the parsed layer at path, parsing it only if it changed since the last Load.
+		 *
+		 * @param path Path of the JSON file of the layer.
+		 * @return Expected_Layer - On success the Document of the layer.
+		 *         On error FILE_OPENING_FAILED or JSON_PARSING_FAILED, the layer is dropped from the cache.
+		 */
+		Expected_Layer Load(const std::filesystem::path& path);
+
+		/**
+		 * @brief Number of layers held by the cache.
+		 */
+		std::size_t Size() const noexcept;
+
+		/**
+		 * @brief Number of parses run since the cache was constructed, cache hits excluded.
+		 */
+		std::size_t Parse_Count() const noexcept;
+
+		/**
+		 * @brief Drop every layer.
+		 */
+		void Clear() noexcept;
+
+	private:
+		struct Layer
+		{
+			std::filesystem::file_time_type write_time;
+			std::uintmax_t size = 0;
+			std::uint64_t content_hash = 0;
+			rapidjson::Document document;
+		};
+
+		std::unordered_map<std::filesystem::path::string_type, Layer> layers;
+		std::size_t parse_count = 0;
+	};
+
+	/**
+	 * @brief Build the application Container from an ordered list of JSON files, each layer overriding the previous ones.
+	 *
+	 * Typical layers are a base file, an environment overlay and a host override. The roots are merged before the module builders run:
+	 * - objects are merged member by member, recursively,
+	 * - any other value (arrays included) replaces the value of the previous layers,
+	 * - within one layer the first occurrence of a key wins, as with Build_From_JSON_File.
+	 *
+	 * Only the module values present in several layers as objects are merged into a copy, the others are given to the builders in place.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param layers Paths of the layers, lowest priority first. Every layer must exist.
+	 * @param cache Parsed layers of the previous builds, see Layer_Cache.
+	 * @return Expected_Builder<Data_Modules...> - On success contains the container.
+	 *         On error contains Error (module name and error id), a layer whose root is not an object fails with JSON_ROOT_IS_NOT_AN_OBJECT.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Layers(std::span<const std::filesystem::path> layers, Layer_Cache& cache);
+
+	/**
+	 * @brief Same as Build_From_JSON_Layers with a Layer_Cache, every layer is parsed.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_From_JSON_Layers(std::span<const std::filesystem::path> layers);
+} // namespace O::Configuration::Application
+
+#include "layered_builder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_LAYERED_BUILDER_H
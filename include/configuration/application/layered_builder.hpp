@@ -0,0 +1,227 @@
+#ifndef CONFIGURATION_APPLICATION_LAYERED_BUILDER_HPP
+#define CONFIGURATION_APPLICATION_LAYERED_BUILDER_HPP
+
+// STL
+#include <array>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// APPLICATION
+#include "fingerprint.h"
+#include "json_builder.h"
+#include "layered_builder.h"
+#include "mapped_file.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+// UTILS
+#include "utils/tuple_helper.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+inline O::Configuration::Application::Layer_Cache::Expected_Layer O::Configuration::Application::Layer_Cache::Load(const std::filesystem::path& path)
+{
+	std::error_code time_error, size_error;
+	const auto write_time = std::filesystem::last_write_time(path, time_error);
+	const auto size = std::filesystem::file_size(path, size_error);
+	if (time_error || size_error)
+	{
+		layers.erase(path.native());
+		return Expected_Layer::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+	}
+
+	auto found = layers.find(path.native());
+	if (found != layers.end() && found->second.write_time == write_time && found->second.size == size)
+		return Expected_Layer::Make_Value(&found->second.document);
+
+	std::optional<Mapped_File> file = Mapped_File::Open(path);
+	if (!file)
+	{
+		layers.erase(path.native());
+		return Expected_Layer::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+	}
+
+	// touched but not modified, the parsed layer is still valid
+	const std::uint64_t content_hash = Detail::Hash_Bytes(std::span<const char>(file->Data(), file->Size()));
+	if (found != layers.end() && found->second.content_hash == content_hash)
+	{
+		found->second.write_time = write_time;
+		found->second.size = size;
+		return Expected_Layer::Make_Value(&found->second.document);
+	}
+
+	// a fresh Document, parsing into the old one would keep its values in the pool
+	if (found != layers.end())
+		layers.erase(found);
+	Layer& layer = layers[path.native()];
+
+	++parse_count;
+	layer.document.Parse(file->Data(), file->Size());
+	if (layer.document.HasParseError())
+	{
+		layers.erase(path.native());
+		return Expected_Layer::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+	}
+
+	layer.write_time = write_time;
+	layer.size = size;
+	layer.content_hash = content_hash;
+	return Expected_Layer::Make_Value(&layer.document);
+}
+
+inline std::size_t O::Configuration::Application::Layer_Cache::Size() const noexcept
+{
+	return layers.size();
+}
+
+inline std::size_t O::Configuration::Application::Layer_Cache::Parse_Count() const noexcept
+{
+	return parse_count;
+}
+
+inline void O::Configuration::Application::Layer_Cache::Clear() noexcept
+{
+	layers.clear();
+}
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Merge overlay into base: objects member by member, recursively, any other value replaces the base value.
+	 */
+	inline void Merge_Layer_Value(rapidjson::Value& base, const rapidjson::Value& overlay, rapidjson::Document::AllocatorType& allocator)
+	{
+		if (!base.IsObject() || !overlay.IsObject())
+		{
+			base.CopyFrom(overlay, allocator);
+			return;
+		}
+
+		for (auto member = overlay.MemberBegin(); member != overlay.MemberEnd(); ++member)
+		{
+			// the first occurrence of a key wins, later ones are ignored as by the builders
+			if (overlay.FindMember(member->name) != member)
+				continue;
+
+			auto target = base.FindMember(member->name);
+			if (target != base.MemberEnd())
+			{
+				Merge_Layer_Value(target->value, member->value, allocator);
+				continue;
+			}
+
+			rapidjson::Value name(member->name, allocator);
+			rapidjson::Value value(member->value, allocator);
+			base.AddMember(name, value, allocator);
+		}
+	}
+
+	/**
+	 * @brief Build the container from the layer roots, lowest priority first.
+	 *
+	 * For each module the value of the highest layer that is not an object hides the layers below it.
+	 * A single remaining value is given to the builder in place, several objects are merged into a copy allocated from a Document local to the build.
+	 */
+	template<class... Data_Modules>
+	Expected_Builder<Data_Modules...> Build_Layered_Document(std::span<const rapidjson::Value* const> roots)
+	{
+		using Members = std::array<rapidjson::Value::ConstMemberIterator, sizeof...(Data_Modules)>;
+
+		std::vector<Members> members;
+		members.reserve(roots.size());
+		for (const rapidjson::Value* root : roots)
+		{
+			if (!root->IsObject())
+				return Expected_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+			members.push_back(Find_Module_Members<Data_Modules...>(*root));
+		}
+
+		Expected_Builder<Data_Modules...> result = Expected_Builder<Data_Modules...>::Make_Value();
+		Container<Data_Modules...>& container = result.Value();
+		rapidjson::Document merged;
+
+		bool ok = true;
+		std::size_t index = 0;
+
+		O::For_Each_In_Tuple(container.modules, [&](auto& module_part)
+			{
+				const std::size_t i = index++;
+				if (!ok) return;
+
+				// walk down from the highest layer until a value that is not an object
+				std::size_t first = roots.size();
+				std::size_t count = 0;
+				for (std::size_t layer = roots.size(); layer-- > 0;)
+				{
+					auto member = members[layer][i];
+					if (member == roots[layer]->MemberEnd())
+						continue;
+					if (!member->value.IsObject() && count != 0)
+						break;
+					first = layer;
+					++count;
+					if (!member->value.IsObject())
+						break;
+				}
+				if (count == 0) return;
+
+				const rapidjson::Value* value = &members[first][i]->value;
+				rapidjson::Value copy;
+				if (count > 1)
+				{
+					copy.CopyFrom(*value, merged.GetAllocator());
+					for (std::size_t layer = first + 1; layer < roots.size(); ++layer)
+						if (members[layer][i] != roots[layer]->MemberEnd())
+							Merge_Layer_Value(copy, members[layer][i]->value, merged.GetAllocator());
+					value = &copy;
+				}
+
+				using ModuleType = std::decay_t<decltype(module_part)>;
+				using Builder = typename O::Configuration::Module::Traits<ModuleType>::Builder;
+
+				Builder builder;
+				auto opt = builder.Load_From_JSON(*value);
+
+				if (opt)
+				{
+					result = Expected_Builder<Data_Modules...>::Make_Error(Error{ Builder::Key(), static_cast<int>(*opt) });
+					ok = false;
+					return;
+				}
+
+				module_part = std::move(*builder);
+			});
+
+		return result;
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_Layers(std::span<const std::filesystem::path> layers, Layer_Cache& cache)
+{
+	std::vector<const rapidjson::Value*> roots;
+	roots.reserve(layers.size());
+	for (const std::filesystem::path& path : layers)
+	{
+		Layer_Cache::Expected_Layer layer = cache.Load(path);
+		if (!layer)
+			return Expected_Builder<Data_Modules...>::Make_Error(layer.Error());
+		roots.push_back(layer.Value());
+	}
+
+	return Detail::Build_Layered_Document<Data_Modules...>(roots);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Builder<Data_Modules...> O::Configuration::Application::Build_From_JSON_Layers(std::span<const std::filesystem::path> layers)
+{
+	Layer_Cache cache;
+	return Build_From_JSON_Layers<Data_Modules...>(layers, cache);
+}
+
+#endif //CONFIGURATION_APPLICATION_LAYERED_BUILDER_HPP
@@ -0,0 +1,130 @@
+#ifndef CONFIGURATION_APPLICATION_LAZY_CONTAINER_H
+#define CONFIGURATION_APPLICATION_LAZY_CONTAINER_H
+
+// STL
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <tuple>
+
+// UTILS
+#include <utils/expected.h>
+
+// APPLICATION
+#include "json_builder.h"
+#include "mapped_file.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application
+{
+	template<class... Data_Modules>
+	class Lazy_Container;
+
+	namespace Detail
+	{
+		/**
+		 * @brief Lazily built module: the JSON value it is built from and the result of the build, set once.
+		 */
+		template<class Data>
+		struct Lazy_Slot
+		{
+			const rapidjson::Value* value = nullptr; /**< nullptr when the document has no member for the module. */
+			std::once_flag built;
+			std::atomic<bool> ready{ false }; /**< Set once module holds the result, checked before call_once by the later accesses. */
+			std::optional<O::Expected<Data, Error>> module;
+		};
+
+		/**
+		 * @brief Everything a Lazy_Container keeps alive: the source, its Document and the module slots.
+		 */
+		template<class... Data_Modules>
+		struct Lazy_State
+		{
+			std::optional<Mapped_File> file;
+			rapidjson::Document doc;
+			std::tuple<Lazy_Slot<Data_Modules>...> slots;
+		};
+	} // namespace Detail
+
+	/**
+	 * @brief Alias describing the expected return type of Build_Lazy_From_JSON_* functions.
+	 */
+	template<class... Data_Modules>
+	using Expected_Lazy_Builder = O::Expected<Lazy_Container<Data_Modules...>, Error>;
+
+	/**
+	 * @brief Container running each module builder on the first access to the module.
+	 *
+	 *  @tparam Data_Modules... : the concrete data types for each module.
+	 *
+	 * The parsed Document is kept for the lifetime of the container and every module keeps a pointer to its JSON value.
+	 * The first Get<T>() runs the builder of T on that value, concurrent first accesses are serialized per module and later ones only read the stored result.
+	 * A module missing from the document is default constructed, as with Build_From_JSON_*.
+	 *
+	 * @note Startup only pays the parse, the builders of modules that are never accessed never run. Use Materialize_All() to check every module eagerly.
+	 */
+	template<class... Data_Modules>
+	class Lazy_Container
+	{
+	public:
+		explicit Lazy_Container(std::unique_ptr<Detail::Lazy_State<Data_Modules...>> state) noexcept : state(std::move(state)) {}
+
+		/**
+		 * @brief Return the module of type T, building it on the first call.
+		 *
+		 * Thread safe. The reference stays valid as long as the container.
+		 *
+		 * @tparam T The module data type.
+		 * @return const O::Expected<T, Error>& - the module, or the error returned by its builder.
+		 */
+		template<class T>
+		const O::Expected<T, Error>& Get() const;
+
+		/**
+		 * @brief Build every module not built yet.
+		 *
+		 * @return std::optional<Error> - the first error in module order, as Build_From_JSON_* would return it.
+		 */
+		std::optional<Error> Materialize_All() const;
+
+		/**
+		 * @brief Whether the module of type T has been built, successfully or not.
+		 */
+		template<class T>
+		bool Is_Materialized() const noexcept;
+
+	private:
+		std::unique_ptr<Detail::Lazy_State<Data_Modules...>> state;
+	};
+
+	/**
+	 * @brief Parse an in-memory JSON string into a Lazy_Container, no module builder runs.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param data JSON text to parse, copied into the Document.
+	 * @return Expected_Lazy_Builder<Data_Modules...> - the container, or a parse error (JSON_PARSING_FAILED, JSON_ROOT_IS_NOT_AN_OBJECT).
+	 */
+	template<class... Data_Modules>
+	Expected_Lazy_Builder<Data_Modules...> Build_Lazy_From_JSON_String(std::string_view data);
+
+	/**
+	 * @brief Parse a JSON file into a Lazy_Container, no module builder runs.
+	 *
+	 * The file is parsed in-situ from a private mapping kept by the container, the Document strings point into it.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 * @param path Path to the JSON file to parse.
+	 * @return Expected_Lazy_Builder<Data_Modules...> - the container, or a parse error (FILE_OPENING_FAILED, JSON_PARSING_FAILED, JSON_ROOT_IS_NOT_AN_OBJECT).
+	 */
+	template<class... Data_Modules>
+	Expected_Lazy_Builder<Data_Modules...> Build_Lazy_From_JSON_File(const std::filesystem::path& path);
+} // namespace O::Configuration::Application
+
+#include "lazy_container.hpp"
+
+#endif //CONFIGURATION_APPLICATION_LAZY_CONTAINER_H
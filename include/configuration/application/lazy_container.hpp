@@ -0,0 +1,121 @@
+#ifndef CONFIGURATION_APPLICATION_LAZY_CONTAINER_HPP
+#define CONFIGURATION_APPLICATION_LAZY_CONTAINER_HPP
+
+// STL
+#include <cstddef>
+#include <utility>
+
+// APPLICATION
+#include "json_builder.h"
+#include "lazy_container.h"
+#include "mapped_file.h"
+
+// MODULE
+#include "configuration/module/traits.h"
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Run the builder of Data once on the value of slot.
+	 */
+	template<class Data>
+	const O::Expected<Data, Error>& Materialize(Lazy_Slot<Data>& slot)
+	{
+		if (slot.ready.load(std::memory_order_acquire))
+			return *slot.module;
+
+		std::call_once(slot.built, [&slot]
+			{
+				using Builder = typename O::Configuration::Module::Traits<Data>::Builder;
+
+				if (!slot.value)
+					slot.module.emplace(O::Expected<Data, Error>::Make_Value());
+				else
+				{
+					Builder builder;
+					if (auto opt = builder.Load_From_JSON(*slot.value))
+						slot.module.emplace(O::Expected<Data, Error>::Make_Error(Error{ Builder::Key(), static_cast<int>(*opt) }));
+					else
+						slot.module.emplace(O::Expected<Data, Error>::Make_Value(std::move(*builder)));
+				}
+				slot.ready.store(true, std::memory_order_release);
+			});
+		return *slot.module;
+	}
+
+	/**
+	 * @brief Point every slot of state to the value of its module in the parsed document.
+	 */
+	template<class... Data_Modules, std::size_t... I>
+	Expected_Lazy_Builder<Data_Modules...> Make_Lazy_Container(std::unique_ptr<Lazy_State<Data_Modules...>> state, std::index_sequence<I...>)
+	{
+		const rapidjson::Value& doc = state->doc;
+		if (!doc.IsObject())
+			return Expected_Lazy_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT) });
+
+		const auto members = Find_Module_Members<Data_Modules...>(doc);
+		((std::get<I>(state->slots).value = members[I] != doc.MemberEnd() ? &members[I]->value : nullptr), ...);
+
+		return Expected_Lazy_Builder<Data_Modules...>::Make_Value(std::move(state));
+	}
+} // namespace O::Configuration::Application::Detail
+
+template<class... Data_Modules>
+template<class T>
+const O::Expected<T, O::Configuration::Application::Error>& O::Configuration::Application::Lazy_Container<Data_Modules...>::Get() const
+{
+	return Detail::Materialize(std::get<Detail::Lazy_Slot<T>>(state->slots));
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Lazy_Container<Data_Modules...>::Materialize_All() const
+{
+	std::optional<Error> error;
+	std::apply([&error](auto&... slot)
+		{
+			auto keep_first = [&error](const auto& module)
+				{
+					if (!error && !module.Has_Value())
+						error = module.Error();
+				};
+			(keep_first(Detail::Materialize(slot)), ...);
+		}, state->slots);
+	return error;
+}
+
+template<class... Data_Modules>
+template<class T>
+bool O::Configuration::Application::Lazy_Container<Data_Modules...>::Is_Materialized() const noexcept
+{
+	return std::get<Detail::Lazy_Slot<T>>(state->slots).ready.load(std::memory_order_acquire);
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Lazy_Builder<Data_Modules...> O::Configuration::Application::Build_Lazy_From_JSON_String(std::string_view data)
+{
+	auto state = std::make_unique<Detail::Lazy_State<Data_Modules...>>();
+
+	rapidjson::ParseResult r = state->doc.template Parse<rapidjson::kParseDefaultFlags>(data.data(), static_cast<rapidjson::SizeType>(data.size()));
+	if (!r)
+		return Expected_Lazy_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+	return Detail::Make_Lazy_Container<Data_Modules...>(std::move(state), std::index_sequence_for<Data_Modules...>{});
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Expected_Lazy_Builder<Data_Modules...> O::Configuration::Application::Build_Lazy_From_JSON_File(const std::filesystem::path& path)
+{
+	auto state = std::make_unique<Detail::Lazy_State<Data_Modules...>>();
+
+	state->file = Mapped_File::Open(path);
+	if (!state->file)
+		return Expected_Lazy_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(FILE_OPENING_FAILED) });
+
+	rapidjson::ParseResult r = state->doc.template ParseInsitu<rapidjson::kParseDefaultFlags>(state->file->Data());
+	if (!r)
+		return Expected_Lazy_Builder<Data_Modules...>::Make_Error(Error{ "", static_cast<int>(JSON_PARSING_FAILED) });
+
+	return Detail::Make_Lazy_Container<Data_Modules...>(std::move(state), std::index_sequence_for<Data_Modules...>{});
+}
+
+#endif //CONFIGURATION_APPLICATION_LAZY_CONTAINER_HPP
@@ -0,0 +1,178 @@
+#ifndef CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_H
+#define CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_H
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+
+// APPLICATION
+#include "container.h"
+#include "json_builder.h"
+#include "parse_context.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Tuning of the file watcher of Live_Configuration.
+	 */
+	struct Live_Options
+	{
+		std::chrono::milliseconds debounce{ 50 };        /**< Quiet period after the last change event before rebuilding. */
+		std::chrono::milliseconds poll_interval{ 500 };  /**< Period of the modification time check when inotify is not used. */
+		Read_Mode read_mode = Read_Mode::STREAM;         /**< Read mode of the rebuilds, prefer STREAM for files truncated in place. */
+		bool force_polling = false;                      /**< Poll the modification time even where inotify is available (network file systems). */
+	};
+
+	namespace Detail
+	{
+		/**
+		 * @brief Copy of a published snapshot kept by each reader thread, loaded again only when the generation of its source changed.
+		 *
+		 * The fast path reads the generation and copies the cached pointer: it neither locks nor allocates, even where std::atomic<std::shared_ptr> does.
+		 * A thread caches the snapshot of one source at a time, and keeps it alive until it reads another one.
+		 */
+		template<class Snapshot_Type>
+		class Snapshot_Cache
+		{
+		public:
+			/**
+			 * @brief Identifier of a new source, never 0.
+			 */
+			static std::uint64_t Next_Source() noexcept
+			{
+				static std::atomic<std::uint64_t> next{ 1 };
+				return next.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Snapshot of source, snapshot is read only when generation differs from the one the cached copy was loaded at.
+			 *
+			 * The publisher stores snapshot before incrementing generation.
+			 */
+			static Snapshot_Type Load(std::uint64_t source, const std::atomic<Snapshot_Type>& snapshot, const std::atomic<std::uint64_t>& generation) noexcept
+			{
+				const std::uint64_t current = generation.load(std::memory_order_acquire);
+				if (cached.source != source || cached.generation != current)
+				{
+					cached.value = snapshot.load(std::memory_order_acquire);
+					cached.source = source;
+					cached.generation = current;
+				}
+				return cached.value;
+			}
+
+		private:
+			struct Entry
+			{
+				std::uint64_t source = 0;
+				std::uint64_t generation = 0;
+				Snapshot_Type value;
+			};
+
+			inline static thread_local Entry cached;
+		};
+	} // namespace Detail
+
+	/**
+	 * @brief Configuration file rebuilt when it changes and published as immutable snapshots.
+	 *
+	 * @tparam Data_Modules List of module data types to include in the container.
+	 *
+	 * A watcher thread waits for changes of the file (inotify on the parent directory on Linux, so replacing the file by a rename is seen, modification time polling elsewhere).
+	 * Bursts of events are debounced, then the Container is rebuilt off the reader threads and swapped into an atomic shared pointer.
+	 * Readers call Snapshot(), which never locks nor allocates once the thread read the current snapshot: each thread caches it and only checks the generation. They keep the returned Container alive as long as they hold it.
+	 * A failed rebuild keeps the previous snapshot and reports the Error through the error callback.
+	 */
+	template<class... Data_Modules>
+	class Live_Configuration
+	{
+	public:
+		using Snapshot_Type = std::shared_ptr<const Container<Data_Modules...>>;
+		using Error_Callback = std::function<void(const Error&)>;
+
+		/**
+		 * @brief Construct the live configuration, nothing is built nor watched yet.
+		 *
+		 * @param path Path of the JSON file.
+		 * @param on_error Called from the watcher thread when a rebuild triggered by a change fails.
+		 * @param options Watcher tuning.
+		 */
+		explicit Live_Configuration(std::filesystem::path path, Error_Callback on_error = {}, Live_Options options = {});
+
+		Live_Configuration(const Live_Configuration&) = delete;
+		Live_Configuration& operator=(const Live_Configuration&) = delete;
+
+		/**
+		 * @brief Stop the watcher.
+		 */
+		~Live_Configuration();
+
+		/**
+		 * @brief Return the last published Container, nullptr before the first successful build.
+		 *
+		 * Only the first call of a thread after a publication reads the shared snapshot, the others return the copy cached by the thread.
+		 */
+		Snapshot_Type Snapshot() const noexcept;
+
+		/**
+		 * @brief Number of snapshots published so far.
+		 */
+		std::uint64_t Generation() const noexcept;
+
+		/**
+		 * @brief Rebuild the Container now from the calling thread and publish it.
+		 *
+		 * @return std::optional<Error> - The build error, in which case the previous snapshot is kept.
+		 */
+		std::optional<Error> Reload();
+
+		/**
+		 * @brief Start the watcher thread, does nothing if it already runs.
+		 *
+		 * @note Start does not build, call Reload() first to publish the initial snapshot.
+		 */
+		void Start();
+
+		/**
+		 * @brief Stop and join the watcher thread.
+		 */
+		void Stop();
+
+		/**
+		 * @brief True while the watcher thread runs.
+		 */
+		bool Is_Watching() const noexcept;
+
+	private:
+		void Watch(std::stop_token stop);
+		bool Watch_Inotify(std::stop_token stop);
+		void Watch_Polling(std::stop_token stop);
+		void Reload_And_Report();
+
+		std::filesystem::path path;
+		Error_Callback on_error;
+		Live_Options options;
+
+		std::atomic<Snapshot_Type> snapshot;
+		std::atomic<std::uint64_t> generation{ 0 };
+		const std::uint64_t source = Detail::Snapshot_Cache<Snapshot_Type>::Next_Source();
+
+		std::mutex rebuild_mutex;
+		Parse_Context context;
+
+		std::jthread watcher;
+	};
+
+} // namespace O::Configuration::Application
+
+#include "live_configuration.hpp"
+
+#endif //CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_H
@@ -0,0 +1,214 @@
+#ifndef CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_HPP
+#define CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_HPP
+
+// STL
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <string>
+#include <system_error>
+#include <utility>
+
+// APPLICATION
+#include "live_configuration.h"
+
+// SYSTEM
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+template<class... Data_Modules>
+O::Configuration::Application::Live_Configuration<Data_Modules...>::Live_Configuration(std::filesystem::path path, Error_Callback on_error, Live_Options options) :
+	path(std::move(path)),
+	on_error(std::move(on_error)),
+	options(options)
+{
+}
+
+template<class... Data_Modules>
+O::Configuration::Application::Live_Configuration<Data_Modules...>::~Live_Configuration()
+{
+	Stop();
+}
+
+template<class... Data_Modules>
+typename O::Configuration::Application::Live_Configuration<Data_Modules...>::Snapshot_Type O::Configuration::Application::Live_Configuration<Data_Modules...>::Snapshot() const noexcept
+{
+	return Detail::Snapshot_Cache<Snapshot_Type>::Load(source, snapshot, generation);
+}
+
+template<class... Data_Modules>
+std::uint64_t O::Configuration::Application::Live_Configuration<Data_Modules...>::Generation() const noexcept
+{
+	return generation.load(std::memory_order_acquire);
+}
+
+template<class... Data_Modules>
+std::optional<O::Configuration::Application::Error> O::Configuration::Application::Live_Configuration<Data_Modules...>::Reload()
+{
+	std::lock_guard lock(rebuild_mutex);
+
+	auto expected = Build_From_JSON_File<Data_Modules...>(path, context, options.read_mode);
+	if (!expected.Has_Value())
+		return expected.Error();
+
+	snapshot.store(std::make_shared<const Container<Data_Modules...>>(std::move(expected).Value()), std::memory_order_release);
+	generation.fetch_add(1, std::memory_order_acq_rel);
+	return std::nullopt;
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Live_Configuration<Data_Modules...>::Start()
+{
+	if (watcher.joinable())
+		return;
+	watcher = std::jthread([this](std::stop_token stop) { Watch(stop); });
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Live_Configuration<Data_Modules...>::Stop()
+{
+	if (!watcher.joinable())
+		return;
+	watcher.request_stop();
+	watcher.join();
+}
+
+template<class... Data_Modules>
+bool O::Configuration::Application::Live_Configuration<Data_Modules...>::Is_Watching() const noexcept
+{
+	return watcher.joinable();
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Live_Configuration<Data_Modules...>::Watch(std::stop_token stop)
+{
+	if (options.force_polling || !Watch_Inotify(stop))
+		Watch_Polling(stop);
+}
+
+template<class... Data_Modules>
+bool O::Configuration::Application::Live_Configuration<Data_Modules...>::Watch_Inotify(std::stop_token stop)
+{
+#ifdef __linux__
+	const std::filesystem::path directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path(".");
+	const std::string filename = path.filename().string();
+
+	int notify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (notify_fd < 0)
+		return false;
+	if (::inotify_add_watch(notify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE) < 0)
+	{
+		::close(notify_fd);
+		return false;
+	}
+
+	// the stop callback wakes poll() through a pipe, it is unregistered before the pipe is closed
+	int wake[2];
+	if (::pipe2(wake, O_NONBLOCK | O_CLOEXEC) != 0)
+	{
+		::close(notify_fd);
+		return false;
+	}
+	{
+		std::stop_callback on_stop(stop, [&wake]
+			{
+				const char byte = 0;
+				[[maybe_unused]] ssize_t written = ::write(wake[1], &byte, 1);
+			});
+
+		using Clock = std::chrono::steady_clock;
+		std::optional<Clock::time_point> deadline;
+		alignas(inotify_event) std::array<char, 4096> events;
+
+		while (!stop.stop_requested())
+		{
+			int timeout = -1;
+			if (deadline)
+				timeout = static_cast<int>(std::max<std::int64_t>(0, std::chrono::ceil<std::chrono::milliseconds>(*deadline - Clock::now()).count()));
+
+			std::array<pollfd, 2> fds = { pollfd{ notify_fd, POLLIN, 0 }, pollfd{ wake[0], POLLIN, 0 } };
+			if (::poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR)
+				break;
+
+			if (fds[0].revents & POLLIN)
+			{
+				ssize_t length;
+				while ((length = ::read(notify_fd, events.data(), events.size())) > 0)
+				{
+					for (ssize_t offset = 0; offset < length;)
+					{
+						const inotify_event* event = reinterpret_cast<const inotify_event*>(events.data() + offset);
+						if (event->len != 0 && filename == event->name)
+							deadline = Clock::now() + options.debounce;
+						offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+					}
+				}
+			}
+
+			if (deadline && Clock::now() >= *deadline && !stop.stop_requested())
+			{
+				deadline.reset();
+				Reload_And_Report();
+			}
+		}
+	}
+
+	::close(wake[0]);
+	::close(wake[1]);
+	::close(notify_fd);
+	return true;
+#else
+	(void)stop;
+	return false;
+#endif
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Live_Configuration<Data_Modules...>::Watch_Polling(std::stop_token stop)
+{
+	using Stamp = std::pair<std::filesystem::file_time_type, std::uintmax_t>;
+	auto read_stamp = [this]() -> std::optional<Stamp>
+		{
+			std::error_code time_error, size_error;
+			auto time = std::filesystem::last_write_time(path, time_error);
+			auto size = std::filesystem::file_size(path, size_error);
+			if (time_error || size_error)
+				return std::nullopt;
+			return Stamp{ time, size };
+		};
+
+	std::mutex sleep_mutex;
+	std::condition_variable sleep;
+	std::stop_callback on_stop(stop, [&]
+		{
+			std::lock_guard wake(sleep_mutex);
+			sleep.notify_all();
+		});
+	std::unique_lock lock(sleep_mutex);
+
+	std::optional<Stamp> last = read_stamp();
+	while (!sleep.wait_for(lock, options.poll_interval, [&stop] { return stop.stop_requested(); }))
+	{
+		std::optional<Stamp> current = read_stamp();
+		if (current == last)
+			continue;
+		last = current;
+		if (current)
+			Reload_And_Report();
+	}
+}
+
+template<class... Data_Modules>
+void O::Configuration::Application::Live_Configuration<Data_Modules...>::Reload_And_Report()
+{
+	std::optional<Error> error = Reload();
+	if (error && on_error)
+		on_error(*error);
+}
+
+#endif //CONFIGURATION_APPLICATION_LIVE_CONFIGURATION_HPP
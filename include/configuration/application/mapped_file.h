@@ -0,0 +1,61 @@
+#ifndef CONFIGURATION_APPLICATION_MAPPED_FILE_H
+#define CONFIGURATION_APPLICATION_MAPPED_FILE_H
+
+// STL
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Private copy-on-write memory mapping of a whole file.
+	 *
+	 * The mapped bytes can be modified without touching the file, which is what rapidjson in-situ parsing needs: strings are unescaped in place and point into the pages.
+	 * The view is always followed by at least one '\0' byte so it can be parsed as a null terminated string.
+	 *
+	 * @note When the platform cannot append the terminator to the mapping (empty file, or size multiple of the page size on Windows) the file is read into a heap buffer instead.
+	 */
+	class Mapped_File
+	{
+	public:
+		/**
+		 * @brief Map the file at path.
+		 *
+		 * @param path Path of the file to map.
+		 * @return std::optional<Mapped_File> - std::nullopt when the file cannot be opened or mapped.
+		 */
+		static std::optional<Mapped_File> Open(const std::filesystem::path& path);
+
+		Mapped_File(Mapped_File&& other) noexcept;
+		Mapped_File& operator=(Mapped_File&& other) noexcept;
+		Mapped_File(const Mapped_File&) = delete;
+		Mapped_File& operator=(const Mapped_File&) = delete;
+		~Mapped_File();
+
+		/**
+		 * @brief Writable, null terminated view of the file content.
+		 */
+		char* Data() noexcept;
+
+		/**
+		 * @brief Size of the file in bytes (the terminator is not counted).
+		 */
+		std::size_t Size() const noexcept;
+
+	private:
+		Mapped_File() = default;
+		void Release() noexcept;
+
+		char* view = nullptr;
+		std::size_t size = 0;
+		std::size_t mapped_size = 0;
+		std::unique_ptr<char[]> buffer;
+	};
+
+} // namespace O::Configuration::Application
+
+#include "mapped_file.hpp"
+
+#endif //CONFIGURATION_APPLICATION_MAPPED_FILE_H
@@ -0,0 +1,164 @@
+#ifndef CONFIGURATION_APPLICATION_MAPPED_FILE_HPP
+#define CONFIGURATION_APPLICATION_MAPPED_FILE_HPP
+
+// STL
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+// APPLICATION
+#include "mapped_file.h"
+
+// SYSTEM
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+inline std::optional<O::Configuration::Application::Mapped_File> O::Configuration::Application::Mapped_File::Open(const std::filesystem::path& path)
+{
+	Mapped_File file;
+
+#ifdef _WIN32
+	HANDLE handle = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		return std::nullopt;
+
+	LARGE_INTEGER file_size;
+	if (!::GetFileSizeEx(handle, &file_size))
+	{
+		::CloseHandle(handle);
+		return std::nullopt;
+	}
+	file.size = static_cast<std::size_t>(file_size.QuadPart);
+
+	SYSTEM_INFO info;
+	::GetSystemInfo(&info);
+
+	// a view cannot extend past the end of the file, the terminator only comes for free when the last page is not full
+	if (file.size != 0 && file.size % info.dwPageSize != 0)
+	{
+		HANDLE mapping = ::CreateFileMappingW(handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (mapping)
+		{
+			file.view = static_cast<char*>(::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+			::CloseHandle(mapping);
+		}
+		if (file.view)
+		{
+			file.mapped_size = file.size;
+			::CloseHandle(handle);
+			return file;
+		}
+	}
+
+	file.buffer = std::make_unique<char[]>(file.size + 1);
+	DWORD read = 0;
+	std::size_t total = 0;
+	while (total < file.size && ::ReadFile(handle, file.buffer.get() + total, static_cast<DWORD>(std::min<std::size_t>(file.size - total, 1u << 30)), &read, nullptr) && read != 0)
+		total += read;
+	::CloseHandle(handle);
+	if (total != file.size)
+		return std::nullopt;
+	file.buffer[file.size] = '\0';
+	file.view = file.buffer.get();
+#else
+	int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return std::nullopt;
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0)
+	{
+		::close(fd);
+		return std::nullopt;
+	}
+	file.size = static_cast<std::size_t>(st.st_size);
+
+	// reserve one more zeroed anonymous page than the file needs, then map the file over its beginning
+	const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	file.mapped_size = (file.size / page + 1) * page;
+	void* base = ::mmap(nullptr, file.mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+	{
+		::close(fd);
+		return std::nullopt;
+	}
+	if (file.size != 0 && ::mmap(base, file.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		::munmap(base, file.mapped_size);
+		::close(fd);
+		return std::nullopt;
+	}
+	::close(fd);
+#ifdef MADV_SEQUENTIAL
+	::madvise(base, file.mapped_size, MADV_SEQUENTIAL);
+#endif
+	file.view = static_cast<char*>(base);
+#endif
+
+	return file;
+}
+
+inline O::Configuration::Application::Mapped_File::Mapped_File(Mapped_File&& other) noexcept :
+	view(std::exchange(other.view, nullptr)),
+	size(std::exchange(other.size, 0)),
+	mapped_size(std::exchange(other.mapped_size, 0)),
+	buffer(std::move(other.buffer))
+{
+}
+
+inline O::Configuration::Application::Mapped_File& O::Configuration::Application::Mapped_File::operator=(Mapped_File&& other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+		view = std::exchange(other.view, nullptr);
+		size = std::exchange(other.size, 0);
+		mapped_size = std::exchange(other.mapped_size, 0);
+		buffer = std::move(other.buffer);
+	}
+	return *this;
+}
+
+inline O::Configuration::Application::Mapped_File::~Mapped_File()
+{
+	Release();
+}
+
+inline char* O::Configuration::Application::Mapped_File::Data() noexcept
+{
+	return view;
+}
+
+inline std::size_t O::Configuration::Application::Mapped_File::Size() const noexcept
+{
+	return size;
+}
+
+inline void O::Configuration::Application::Mapped_File::Release() noexcept
+{
+	if (view && !buffer)
+	{
+#ifdef _WIN32
+		::UnmapViewOfFile(view);
+#else
+		::munmap(view, mapped_size);
+#endif
+	}
+	view = nullptr;
+	buffer.reset();
+}
+
+#endif //CONFIGURATION_APPLICATION_MAPPED_FILE_HPP
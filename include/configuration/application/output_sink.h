@@ -0,0 +1,124 @@
+#ifndef CONFIGURATION_APPLICATION_OUTPUT_SINK_H
+#define CONFIGURATION_APPLICATION_OUTPUT_SINK_H
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Errors returned when writing configuration to a file or a sink.
+	 *
+	 * FILE_OPEN_FAILED - Could not open target file for writing.
+	 * FILE_WRITE_FAILED - Generic failure writing to the file (disk full, etc).
+	 * BUFFER_TOO_SMALL - The caller provided buffer cannot hold the whole document.
+	 */
+	enum class Write_Error {
+		FILE_OPEN_FAILED,
+		FILE_WRITE_FAILED,
+		BUFFER_TOO_SMALL
+	};
+
+	/**
+	 * @brief Destination of the buffered JSON writers.
+	 *
+	 * A sink receives the document in chunks of at most the writer buffer size and must provide:
+	 * @code
+	 * std::optional<Write_Error> Write(const char* data, std::size_t size); // std::nullopt once all of data is written
+	 * @endcode
+	 * After the first error the writer stops calling Write and returns the error.
+	 */
+
+	/**
+	 * @brief Sink writing to a file descriptor, retrying partial and interrupted writes.
+	 *
+	 * The descriptor is not owned.
+	 */
+	class Fd_Sink
+	{
+	public:
+		explicit Fd_Sink(int fd) noexcept : fd(fd) {}
+
+		std::optional<Write_Error> Write(const char* data, std::size_t size);
+
+	private:
+		int fd;
+	};
+
+	/**
+	 * @brief Sink writing to a stdio stream, the stream is not owned nor flushed.
+	 */
+	class File_Sink
+	{
+	public:
+		explicit File_Sink(FILE* file) noexcept : file(file) {}
+
+		std::optional<Write_Error> Write(const char* data, std::size_t size);
+
+	private:
+		FILE* file;
+	};
+
+	/**
+	 * @brief Fixed capacity byte ring shared by one producer and one consumer thread.
+	 *
+	 * The producer appends whole chunks with Write, the consumer drains them with Read, possibly while the document is being written.
+	 */
+	class Ring_Buffer
+	{
+	public:
+		/**
+		 * @param capacity Number of bytes the ring can hold, rounded up to a power of two.
+		 */
+		explicit Ring_Buffer(std::size_t capacity);
+
+		/**
+		 * @brief Append all of data, or nothing when the free space is too small.
+		 */
+		bool Write(const char* data, std::size_t size) noexcept;
+
+		/**
+		 * @brief Move up to out.size() bytes from the ring into out.
+		 *
+		 * @return std::size_t - number of bytes read.
+		 */
+		std::size_t Read(std::span<char> out) noexcept;
+
+		/**
+		 * @brief Number of bytes waiting to be read.
+		 */
+		std::size_t Size() const noexcept;
+
+		std::size_t Capacity() const noexcept;
+
+	private:
+		std::unique_ptr<char[]> bytes;
+		std::size_t mask;
+		alignas(64) std::atomic<std::size_t> head{ 0 };
+		alignas(64) std::atomic<std::size_t> tail{ 0 };
+	};
+
+	/**
+	 * @brief Sink appending to a Ring_Buffer, fails with BUFFER_TOO_SMALL when a chunk does not fit in the free space.
+	 */
+	class Ring_Buffer_Sink
+	{
+	public:
+		explicit Ring_Buffer_Sink(Ring_Buffer& ring) noexcept : ring(ring) {}
+
+		std::optional<Write_Error> Write(const char* data, std::size_t size);
+
+	private:
+		Ring_Buffer& ring;
+	};
+
+} // namespace O::Configuration::Application
+
+#include "output_sink.hpp"
+
+#endif //CONFIGURATION_APPLICATION_OUTPUT_SINK_H
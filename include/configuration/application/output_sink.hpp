@@ -0,0 +1,209 @@
+#ifndef CONFIGURATION_APPLICATION_OUTPUT_SINK_HPP
+#define CONFIGURATION_APPLICATION_OUTPUT_SINK_HPP
+
+// STL
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+// APPLICATION
+#include "output_sink.h"
+
+// SYSTEM
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief rapidjson output stream gathering the characters in a buffer and handing it to the sink when full, so the sink sees few large writes.
+	 */
+	template<class Sink>
+	class Buffered_Stream
+	{
+	public:
+		using Ch = char;
+
+		Buffered_Stream(Sink& sink, std::span<char> buffer) : sink(sink), buffer(buffer) {}
+
+		void Put(char c)
+		{
+			if (size == buffer.size())
+				Drain();
+			buffer[size++] = c;
+		}
+
+		void Flush()
+		{
+			Drain();
+		}
+
+		/**
+		 * @brief First error returned by the sink.
+		 */
+		std::optional<Write_Error> Error() const noexcept
+		{
+			return error;
+		}
+
+	private:
+		void Drain()
+		{
+			if (size != 0 && !error)
+				error = sink.Write(buffer.data(), size);
+			size = 0;
+		}
+
+		Sink& sink;
+		std::span<char> buffer;
+		std::size_t size = 0;
+		std::optional<Write_Error> error;
+	};
+
+	/**
+	 * @brief Create or truncate path for writing, return the descriptor or -1.
+	 */
+	inline int Open_For_Writing(const std::filesystem::path& path)
+	{
+#ifdef _WIN32
+		return ::_wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		int fd;
+		do
+			fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+		while (fd < 0 && errno == EINTR);
+		return fd;
+#endif
+	}
+
+	/**
+	 * @brief Optionally flush fd to the storage, then close it. False when either failed.
+	 */
+	inline bool Close_File(int fd, bool sync)
+	{
+#ifdef _WIN32
+		const bool synced = !sync || ::_commit(fd) == 0;
+		return ::_close(fd) == 0 && synced;
+#else
+		const bool synced = !sync || ::fsync(fd) == 0;
+		return ::close(fd) == 0 && synced;
+#endif
+	}
+
+	/**
+	 * @brief Path next to path, unique to this process and call, for a file renamed over path once complete.
+	 */
+	inline std::filesystem::path Temporary_Path(const std::filesystem::path& path)
+	{
+		static std::atomic<unsigned> counter{ 0 };
+#ifdef _WIN32
+		const int pid = ::_getpid();
+#else
+		const int pid = static_cast<int>(::getpid());
+#endif
+		std::filesystem::path temporary = path;
+		temporary += "." + std::to_string(pid) + "." + std::to_string(counter.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+		return temporary;
+	}
+} // namespace O::Configuration::Application::Detail
+
+inline std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Fd_Sink::Write(const char* data, std::size_t size)
+{
+	while (size != 0)
+	{
+#ifdef _WIN32
+		const int written = ::_write(fd, data, static_cast<unsigned>(std::min<std::size_t>(size, 1u << 30)));
+#else
+		const ::ssize_t written = ::write(fd, data, size);
+#endif
+		if (written < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return Write_Error::FILE_WRITE_FAILED;
+		}
+		data += written;
+		size -= static_cast<std::size_t>(written);
+	}
+	return std::nullopt;
+}
+
+inline std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::File_Sink::Write(const char* data, std::size_t size)
+{
+	if (std::fwrite(data, 1, size, file) != size)
+		return Write_Error::FILE_WRITE_FAILED;
+	return std::nullopt;
+}
+
+inline O::Configuration::Application::Ring_Buffer::Ring_Buffer(std::size_t capacity) :
+	bytes(std::make_unique<char[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+	mask(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1)
+{
+}
+
+inline bool O::Configuration::Application::Ring_Buffer::Write(const char* data, std::size_t size) noexcept
+{
+	const std::size_t current_tail = tail.load(std::memory_order_relaxed);
+	const std::size_t current_head = head.load(std::memory_order_acquire);
+	if (size > Capacity() - (current_tail - current_head))
+		return false;
+	if (size == 0)
+		return true;
+
+	// the free space may wrap around the end of the storage
+	const std::size_t offset = current_tail & mask;
+	const std::size_t first = std::min(size, Capacity() - offset);
+	std::memcpy(bytes.get() + offset, data, first);
+	std::memcpy(bytes.get(), data + first, size - first);
+
+	tail.store(current_tail + size, std::memory_order_release);
+	return true;
+}
+
+inline std::size_t O::Configuration::Application::Ring_Buffer::Read(std::span<char> out) noexcept
+{
+	const std::size_t current_head = head.load(std::memory_order_relaxed);
+	const std::size_t current_tail = tail.load(std::memory_order_acquire);
+	const std::size_t size = std::min(out.size(), current_tail - current_head);
+	if (size == 0)
+		return 0;
+
+	const std::size_t offset = current_head & mask;
+	const std::size_t first = std::min(size, Capacity() - offset);
+	std::memcpy(out.data(), bytes.get() + offset, first);
+	std::memcpy(out.data() + first, bytes.get(), size - first);
+
+	head.store(current_head + size, std::memory_order_release);
+	return size;
+}
+
+inline std::size_t O::Configuration::Application::Ring_Buffer::Size() const noexcept
+{
+	// head first: the tail loaded afterwards can only be further ahead
+	const std::size_t current_head = head.load(std::memory_order_acquire);
+	return tail.load(std::memory_order_acquire) - current_head;
+}
+
+inline std::size_t O::Configuration::Application::Ring_Buffer::Capacity() const noexcept
+{
+	return mask + 1;
+}
+
+inline std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Ring_Buffer_Sink::Write(const char* data, std::size_t size)
+{
+	if (!ring.Write(data, size))
+		return Write_Error::BUFFER_TOO_SMALL;
+	return std::nullopt;
+}
+
+#endif //CONFIGURATION_APPLICATION_OUTPUT_SINK_HPP
@@ -0,0 +1,88 @@
+#ifndef CONFIGURATION_APPLICATION_PARSE_CONTEXT_H
+#define CONFIGURATION_APPLICATION_PARSE_CONTEXT_H
+
+// STL
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Parsing state reused across Build_From_JSON_* calls.
+	 *
+	 * Owns the value pool and the parse stack pool of the rapidjson Document, both backed by buffers of the context, and the read buffer of the file builders.
+	 * Before each build the pools are cleared; when the previous build did not fit in the buffers they are first grown to the size it used.
+	 * Once the buffers fit the largest document, builds make no heap allocation inside rapidjson.
+	 *
+	 * @note A context is not thread safe and the Document it hands out is only valid until the next build using the context.
+	 */
+	class Parse_Context
+	{
+	public:
+		using Pool = rapidjson::MemoryPoolAllocator<>;
+		using Document = rapidjson::GenericDocument<rapidjson::UTF8<>, Pool, Pool>;
+
+		/// Default size of the pool buffers and of the chunks they grow by.
+		static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+		/// Size of the read buffer used by the stream file mode.
+		static constexpr std::size_t READ_BUFFER_SIZE = 64 * 1024;
+
+		/**
+		 * @brief Construct the context.
+		 *
+		 * @param chunk_size Initial size of the value and stack pool buffers, also used as the size of the chunks allocated when a build overflows them.
+		 */
+		explicit Parse_Context(std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+		Parse_Context(const Parse_Context&) = delete;
+		Parse_Context& operator=(const Parse_Context&) = delete;
+
+		/**
+		 * @brief Return the emptied Document for the next build, growing the pool buffers if the previous build overflowed them.
+		 */
+		Document& Acquire_Document();
+
+		/**
+		 * @brief Read buffer of the stream file mode.
+		 */
+		std::span<char> Read_Buffer() noexcept;
+
+		/**
+		 * @brief Current capacity of the value pool, buffer and overflow chunks included.
+		 */
+		std::size_t Value_Pool_Capacity() const noexcept;
+
+		/**
+		 * @brief Current capacity of the parse stack pool, buffer and overflow chunks included.
+		 */
+		std::size_t Stack_Pool_Capacity() const noexcept;
+
+	private:
+		void Allocate(std::size_t value_size, std::size_t stack_size);
+
+		std::size_t chunk_size;
+		std::unique_ptr<char[]> read_buffer;
+
+		std::unique_ptr<char[]> value_buffer;
+		std::size_t value_buffer_size = 0;
+		std::size_t value_buffer_capacity = 0;
+		std::unique_ptr<char[]> stack_buffer;
+		std::size_t stack_buffer_size = 0;
+		std::size_t stack_buffer_capacity = 0;
+
+		// declared after the buffers and in dependency order so they are destroyed first
+		std::optional<Pool> value_pool;
+		std::optional<Pool> stack_pool;
+		std::optional<Document> document;
+	};
+
+} // namespace O::Configuration::Application
+
+#include "parse_context.hpp"
+
+#endif //CONFIGURATION_APPLICATION_PARSE_CONTEXT_H
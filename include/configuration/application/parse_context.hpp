@@ -0,0 +1,70 @@
+#ifndef CONFIGURATION_APPLICATION_PARSE_CONTEXT_HPP
+#define CONFIGURATION_APPLICATION_PARSE_CONTEXT_HPP
+
+// STL
+#include <algorithm>
+
+// APPLICATION
+#include "parse_context.h"
+
+inline O::Configuration::Application::Parse_Context::Parse_Context(std::size_t chunk_size) :
+	chunk_size(std::max<std::size_t>(chunk_size, 1024)),
+	read_buffer(new char[READ_BUFFER_SIZE])
+{
+	Allocate(this->chunk_size, this->chunk_size);
+}
+
+inline O::Configuration::Application::Parse_Context::Document& O::Configuration::Application::Parse_Context::Acquire_Document()
+{
+	document->SetNull();
+
+	// an overflowing pool chained heap chunks to its buffer, replace the buffer by one holding everything that was used
+	const std::size_t value_capacity = value_pool->Capacity();
+	const std::size_t stack_capacity = stack_pool->Capacity();
+	if (value_capacity > value_buffer_capacity || stack_capacity > stack_buffer_capacity)
+	{
+		Allocate(value_buffer_size + value_capacity - value_buffer_capacity, stack_buffer_size + stack_capacity - stack_buffer_capacity);
+		return *document;
+	}
+
+	value_pool->Clear();
+	stack_pool->Clear();
+	return *document;
+}
+
+inline std::span<char> O::Configuration::Application::Parse_Context::Read_Buffer() noexcept
+{
+	return std::span<char>(read_buffer.get(), READ_BUFFER_SIZE);
+}
+
+inline std::size_t O::Configuration::Application::Parse_Context::Value_Pool_Capacity() const noexcept
+{
+	return value_pool->Capacity();
+}
+
+inline std::size_t O::Configuration::Application::Parse_Context::Stack_Pool_Capacity() const noexcept
+{
+	return stack_pool->Capacity();
+}
+
+inline void O::Configuration::Application::Parse_Context::Allocate(std::size_t value_size, std::size_t stack_size)
+{
+	document.reset();
+	stack_pool.reset();
+	value_pool.reset();
+
+	value_buffer.reset(new char[value_size]);
+	value_buffer_size = value_size;
+	stack_buffer.reset(new char[stack_size]);
+	stack_buffer_size = stack_size;
+
+	value_pool.emplace(value_buffer.get(), value_buffer_size, chunk_size);
+	stack_pool.emplace(stack_buffer.get(), stack_buffer_size, chunk_size);
+	value_buffer_capacity = value_pool->Capacity();
+	stack_buffer_capacity = stack_pool->Capacity();
+
+	// 1024 is the default initial parse stack capacity of rapidjson
+	document.emplace(&*value_pool, 1024, &*stack_pool);
+}
+
+#endif //CONFIGURATION_APPLICATION_PARSE_CONTEXT_HPP
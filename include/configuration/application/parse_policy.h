@@ -0,0 +1,58 @@
+#ifndef CONFIGURATION_APPLICATION_PARSE_POLICY_H
+#define CONFIGURATION_APPLICATION_PARSE_POLICY_H
+
+// STL
+#include <concepts>
+
+// RAPIDJSON
+#include <rapidjson/reader.h>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Options of a Parse_Policy, combined with |.
+	 */
+	enum Parse_Option : unsigned {
+		INSITU          = rapidjson::kParseInsituFlag,          /**< Build_From_JSON_String copies the text once and parses it in place, strings are not copied one by one. */
+		VALIDATE_UTF8   = rapidjson::kParseValidateEncodingFlag, /**< Reject strings that are not valid UTF-8. */
+		FULL_PRECISION  = rapidjson::kParseFullPrecisionFlag,   /**< Correctly rounded doubles instead of the fast conversion, off by up to 3 ULP. */
+		COMMENTS        = rapidjson::kParseCommentsFlag,        /**< Accept C and C++ comments. */
+		TRAILING_COMMAS = rapidjson::kParseTrailingCommasFlag,  /**< Accept a comma after the last member or element. */
+		NAN_AND_INF     = rapidjson::kParseNanAndInfFlag        /**< Accept NaN, Inf and Infinity as numbers. */
+	};
+
+	/**
+	 * @brief Compile-time parse policy of the Build_From_JSON_* overloads taking one.
+	 *
+	 * FLAGS are the rapidjson parse flags. The file builders ignore INSITU: Read_Mode::MEMORY_MAPPED always parses in place and the stream mode cannot.
+	 */
+	template<class T>
+	concept JSON_Parse_Policy = requires
+	{
+		{ T::FLAGS } -> std::convertible_to<unsigned>;
+	};
+
+	/**
+	 * @brief Parse policy made of Parse_Option values.
+	 */
+	template<unsigned OPTIONS>
+	struct Parse_Policy
+	{
+		static constexpr unsigned FLAGS = OPTIONS;
+	};
+
+	/// rapidjson defaults, used by the overloads without policy.
+	using Default_Parse = Parse_Policy<rapidjson::kParseDefaultFlags>;
+
+	/// Hand edited files: comments and trailing commas.
+	using Relaxed_Parse = Parse_Policy<static_cast<unsigned>(rapidjson::kParseDefaultFlags) | COMMENTS | TRAILING_COMMAS>;
+
+	/// Untrusted input: UTF-8 validation and correctly rounded numbers.
+	using Strict_Parse = Parse_Policy<static_cast<unsigned>(rapidjson::kParseDefaultFlags) | VALIDATE_UTF8 | FULL_PRECISION>;
+
+	/// Trusted, machine generated input: in place parsing, no validation and fast numbers.
+	using Fast_Parse = Parse_Policy<INSITU>;
+
+} // namespace O::Configuration::Application
+
+#endif //CONFIGURATION_APPLICATION_PARSE_POLICY_H
@@ -0,0 +1,67 @@
+#ifndef CONFIGURATION_APPLICATION_SHARED_CONTAINER_H
+#define CONFIGURATION_APPLICATION_SHARED_CONTAINER_H
+
+// STL
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+
+// APPLICATION
+#include "container.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Container whose modules are immutable and shared between successive builds.
+	 *
+	 *  @tparam Data_Modules... : the concrete data types for each module.
+	 *
+	 * Each module is held by a std::shared_ptr<const T> together with the fingerprint of the JSON value it was built from.
+	 * Rebuild_From_JSON_* copies the pointers of the modules whose fingerprint did not change, so they are shared with the previous container instead of being rebuilt.
+	 * A default constructed Shared_Container holds default modules and no fingerprint, rebuilding from it builds every module.
+	 */
+	template<class... Data_Modules>
+	struct Shared_Container
+	{
+		/// The shared modules, never null.
+		std::tuple<std::shared_ptr<const Data_Modules>...> modules{ std::make_shared<const Data_Modules>()... };
+
+		/// Fingerprint of the JSON value of each module, in module order, std::nullopt when the module was not built from JSON.
+		std::array<std::optional<std::uint64_t>, sizeof...(Data_Modules)> fingerprints{};
+
+		/**
+		 * @brief Return a reference to the module of type T.
+		 *
+		 * @tparam T The module data type.
+		 */
+		template<class T>
+		const T& Get() const
+		{
+			return *std::get<std::shared_ptr<const T>>(modules);
+		}
+
+		/**
+		 * @brief Return the shared pointer holding the module of type T, to keep it alive independently of the container.
+		 *
+		 * @tparam T The module data type.
+		 */
+		template<class T>
+		const std::shared_ptr<const T>& Get_Shared() const
+		{
+			return std::get<std::shared_ptr<const T>>(modules);
+		}
+
+		/**
+		 * @brief Copy the modules into a plain Container.
+		 */
+		Container<Data_Modules...> To_Container() const
+		{
+			return Container<Data_Modules...>{ std::tuple<Data_Modules...>(Get<Data_Modules>()...) };
+		}
+	};
+
+} // namespace O::Configuration::Application
+
+#endif //CONFIGURATION_APPLICATION_SHARED_CONTAINER_H
@@ -0,0 +1,96 @@
+#ifndef CONFIGURATION_APPLICATION_THREAD_POOL_H
+#define CONFIGURATION_APPLICATION_THREAD_POOL_H
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Work-stealing thread pool running groups of tasks.
+	 *
+	 * Every worker owns a task queue: it pops its own tasks last in first out and steals from the other queues first in first out when its queue is empty.
+	 * Run() is a fork-join: the calling thread also executes tasks until its group is done, so a task may itself call Run() without deadlocking the pool.
+	 */
+	class Thread_Pool
+	{
+	public:
+		using Task = std::function<void()>;
+
+		/**
+		 * @brief Start the workers.
+		 *
+		 * @param thread_count Number of worker threads, with 0 every task runs on the thread calling Run().
+		 */
+		explicit Thread_Pool(std::size_t thread_count = Default_Thread_Count());
+
+		Thread_Pool(const Thread_Pool&) = delete;
+		Thread_Pool& operator=(const Thread_Pool&) = delete;
+
+		/**
+		 * @brief Finish the queued tasks and join the workers.
+		 */
+		~Thread_Pool();
+
+		/**
+		 * @brief Pool shared by the library when the caller does not provide one, created on first use with Default_Thread_Count() workers.
+		 */
+		static Thread_Pool& Shared();
+
+		/**
+		 * @brief Number of hardware threads, at least 1.
+		 */
+		static std::size_t Default_Thread_Count() noexcept;
+
+		/**
+		 * @brief Number of worker threads.
+		 */
+		std::size_t Size() const noexcept;
+
+		/**
+		 * @brief Run every task and return when all are done.
+		 *
+		 * @param tasks Tasks to run, possibly concurrently and in any order.
+		 * @throw Rethrow the exception of the first task, in span order, that threw one.
+		 */
+		void Run(std::span<const Task> tasks);
+
+	private:
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		void Push(Task task);
+		bool Pop(Task& task);
+		void Work(std::size_t index);
+
+		std::vector<std::unique_ptr<Queue>> queues;
+		std::atomic<std::size_t> next_queue{ 0 };
+		std::atomic<std::size_t> pending{ 0 };
+
+		std::mutex sleep_mutex;
+		std::condition_variable sleep;
+		bool stopping = false;
+
+		std::vector<std::thread> workers;
+
+		inline static thread_local const Thread_Pool* current_pool = nullptr;
+		inline static thread_local std::size_t current_index = 0;
+	};
+
+} // namespace O::Configuration::Application
+
+#include "thread_pool.hpp"
+
+#endif //CONFIGURATION_APPLICATION_THREAD_POOL_H
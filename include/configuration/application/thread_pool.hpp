@@ -0,0 +1,159 @@
+#ifndef CONFIGURATION_APPLICATION_THREAD_POOL_HPP
+#define CONFIGURATION_APPLICATION_THREAD_POOL_HPP
+
+// STL
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+// APPLICATION
+#include "thread_pool.h"
+
+inline O::Configuration::Application::Thread_Pool::Thread_Pool(std::size_t thread_count)
+{
+	queues.reserve(std::max<std::size_t>(thread_count, 1));
+	for (std::size_t i = 0; i < std::max<std::size_t>(thread_count, 1); ++i)
+		queues.push_back(std::make_unique<Queue>());
+
+	workers.reserve(thread_count);
+	for (std::size_t i = 0; i < thread_count; ++i)
+		workers.emplace_back([this, i] { Work(i); });
+}
+
+inline O::Configuration::Application::Thread_Pool::~Thread_Pool()
+{
+	{
+		std::lock_guard lock(sleep_mutex);
+		stopping = true;
+	}
+	sleep.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+inline O::Configuration::Application::Thread_Pool& O::Configuration::Application::Thread_Pool::Shared()
+{
+	static Thread_Pool pool;
+	return pool;
+}
+
+inline std::size_t O::Configuration::Application::Thread_Pool::Default_Thread_Count() noexcept
+{
+	return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+inline std::size_t O::Configuration::Application::Thread_Pool::Size() const noexcept
+{
+	return workers.size();
+}
+
+inline void O::Configuration::Application::Thread_Pool::Run(std::span<const Task> tasks)
+{
+	struct Group
+	{
+		std::atomic<std::size_t> remaining;
+		std::vector<std::exception_ptr> errors;
+		std::mutex mutex;
+		std::condition_variable done;
+	};
+
+	Group group{ tasks.size(), std::vector<std::exception_ptr>(tasks.size()), {}, {} };
+
+	for (std::size_t i = 0; i < tasks.size(); ++i)
+	{
+		Push([&group, &task = tasks[i], i]
+			{
+				try
+				{
+					task();
+				}
+				catch (...)
+				{
+					group.errors[i] = std::current_exception();
+				}
+				// decremented under the lock: Run locks the mutex before returning, so the group outlives this last access
+				std::lock_guard lock(group.mutex);
+				if (group.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					group.done.notify_all();
+			});
+	}
+
+	// help until the queues are empty, the tasks of the group still running are then owned by other threads
+	Task task;
+	while (group.remaining.load(std::memory_order_acquire) != 0 && Pop(task))
+		std::exchange(task, nullptr)();
+
+	{
+		std::unique_lock lock(group.mutex);
+		group.done.wait(lock, [&group] { return group.remaining.load(std::memory_order_acquire) == 0; });
+	}
+
+	for (const std::exception_ptr& error : group.errors)
+		if (error)
+			std::rethrow_exception(error);
+}
+
+inline void O::Configuration::Application::Thread_Pool::Push(Task task)
+{
+	const std::size_t index = current_pool == this ? current_index : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+	{
+		std::lock_guard lock(sleep_mutex);
+		pending.fetch_add(1, std::memory_order_relaxed);
+	}
+	{
+		std::lock_guard lock(queues[index]->mutex);
+		queues[index]->tasks.push_back(std::move(task));
+	}
+	sleep.notify_one();
+}
+
+inline bool O::Configuration::Application::Thread_Pool::Pop(Task& task)
+{
+	const bool is_worker = current_pool == this;
+	const std::size_t start = is_worker ? current_index : 0;
+
+	// own queue from the back, then steal from the front of the others
+	for (std::size_t offset = 0; offset < queues.size(); ++offset)
+	{
+		Queue& queue = *queues[(start + offset) % queues.size()];
+		std::lock_guard lock(queue.mutex);
+		if (queue.tasks.empty())
+			continue;
+		if (is_worker && offset == 0)
+		{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+		}
+		else
+		{
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+		}
+		pending.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+	return false;
+}
+
+inline void O::Configuration::Application::Thread_Pool::Work(std::size_t index)
+{
+	current_pool = this;
+	current_index = index;
+
+	Task task;
+	while (true)
+	{
+		if (Pop(task))
+		{
+			std::exchange(task, nullptr)();
+			continue;
+		}
+
+		std::unique_lock lock(sleep_mutex);
+		sleep.wait(lock, [this] { return stopping || pending.load(std::memory_order_relaxed) != 0; });
+		if (stopping && pending.load(std::memory_order_relaxed) == 0)
+			return;
+	}
+}
+
+#endif //CONFIGURATION_APPLICATION_THREAD_POOL_HPP
@@ -0,0 +1,153 @@
+#ifndef CONFIGURATION_APPLICATION_TRACE_RECORDER_H
+#define CONFIGURATION_APPLICATION_TRACE_RECORDER_H
+
+// STL
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// APPLICATION
+#include "instrumentation.h"
+#include "output_sink.h"
+
+namespace O::Configuration::Application
+{
+	/**
+	 * @brief Heap allocations made since an arbitrary origin, as returned by an allocation probe.
+	 */
+	struct Allocation_Totals
+	{
+		std::size_t count = 0;
+		std::size_t bytes = 0;
+	};
+
+	/**
+	 * @brief One step recorded by a Trace_Recorder.
+	 */
+	struct Trace_Event
+	{
+		Phase phase;
+		std::string key;                 /**< Module key, empty for Phase::PARSE. */
+		std::uint64_t start_ns;          /**< Start of the step, from the construction or the last Clear of the recorder. */
+		std::uint64_t duration_ns;
+		std::size_t allocations;         /**< Allocations made during the step, 0 without probe. */
+		std::size_t allocated_bytes;
+		std::size_t size;                /**< Size reported for the step, see Phase. */
+	};
+
+	/**
+	 * @brief Totals of the steps of one module.
+	 */
+	struct Module_Stats
+	{
+		std::string key;
+		std::size_t loads = 0;           /**< Number of Load_From_JSON recorded. */
+		std::uint64_t load_ns = 0;
+		std::size_t input_bytes = 0;     /**< Serialized size of the JSON values loaded. */
+		std::size_t writes = 0;          /**< Number of To_JSON recorded. */
+		std::uint64_t write_ns = 0;
+		std::size_t output_bytes = 0;
+		std::size_t allocations = 0;     /**< Allocations made by the loads and writes of the module. */
+		std::size_t allocated_bytes = 0;
+	};
+
+	/**
+	 * @brief Totals of the events of a Trace_Recorder.
+	 */
+	struct Trace_Stats
+	{
+		std::size_t parses = 0;          /**< Number of documents parsed. */
+		std::uint64_t parse_ns = 0;
+		std::size_t parse_input_bytes = 0;
+		std::size_t parse_allocations = 0;
+		std::size_t parse_allocated_bytes = 0;
+		std::vector<Module_Stats> modules; /**< One entry per module key, in the order they were first recorded. */
+
+		/**
+		 * @brief Stats of the module with key, nullptr when none of its steps were recorded.
+		 */
+		const Module_Stats* Find(std::string_view key) const noexcept;
+	};
+
+	/**
+	 * @brief Instrumentation policy recording the time, allocations and size of each step.
+	 *
+	 * Pass it to the instrumented Build_From_JSON_* and Write_As_JSON_* overloads, then read Stats() or export the events with Write_Chrome_Trace.
+	 * Allocations are only counted with a probe returning the allocation totals of the program, the library does not replace operator new.
+	 * Not thread safe: record one build or write at a time.
+	 *
+	 * @code
+	 * Trace_Recorder recorder;
+	 * Parse_Context context;
+	 * auto result = Build_From_JSON_File<Numeric, Range>("config.json", context, recorder);
+	 * recorder.Write_Chrome_Trace("reload.trace.json");
+	 * @endcode
+	 */
+	class Trace_Recorder
+	{
+	public:
+		using Allocation_Probe = Allocation_Totals (*)();
+
+		struct Scope
+		{
+			std::chrono::steady_clock::time_point start;
+			Allocation_Totals allocations;
+		};
+
+		static constexpr bool ENABLED = true;
+
+		/**
+		 * @param probe Function returning the allocation totals of the program, nullptr to record no allocation.
+		 */
+		explicit Trace_Recorder(Allocation_Probe probe = nullptr);
+
+		Scope Begin() const;
+		void End(const Scope& scope, Phase phase, std::string_view key, std::size_t size);
+
+		/**
+		 * @brief Recorded steps, in the order they ended.
+		 */
+		const std::vector<Trace_Event>& Events() const noexcept;
+
+		/**
+		 * @brief Recorded steps summed per module.
+		 */
+		Trace_Stats Stats() const;
+
+		/**
+		 * @brief Forget the recorded steps and restart the clock.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 * @brief Recorded steps in the Chrome trace event format, readable by chrome://tracing and Perfetto.
+		 */
+		std::string Chrome_Trace_JSON() const;
+
+		/**
+		 * @brief Write Chrome_Trace_JSON to path.
+		 *
+		 * @return std::optional<Write_Error> - std::nullopt on success, otherwise the error.
+		 */
+		std::optional<Write_Error> Write_Chrome_Trace(const std::filesystem::path& path) const;
+
+	private:
+		Allocation_Totals Allocations() const;
+
+		Allocation_Probe probe;
+		std::chrono::steady_clock::time_point origin;
+		std::vector<Trace_Event> events;
+	};
+
+	static_assert(Instrumentation_Policy<Trace_Recorder>);
+
+} // namespace O::Configuration::Application
+
+#include "trace_recorder.hpp"
+
+#endif //CONFIGURATION_APPLICATION_TRACE_RECORDER_H
@@ -0,0 +1,181 @@
+#ifndef CONFIGURATION_APPLICATION_TRACE_RECORDER_HPP
+#define CONFIGURATION_APPLICATION_TRACE_RECORDER_HPP
+
+// STL
+#include <algorithm>
+
+// APPLICATION
+#include "trace_recorder.h"
+#include "json_writer.h"
+
+// RAPIDJSON
+#include <rapidjson/writer.h>
+
+namespace O::Configuration::Application::Detail
+{
+	/**
+	 * @brief Name of a phase in the trace events.
+	 */
+	inline const char* Phase_Name(Phase phase) noexcept
+	{
+		switch (phase)
+		{
+		case Phase::PARSE: return "parse";
+		case Phase::LOAD:  return "load";
+		case Phase::WRITE: return "write";
+		}
+		return "";
+	}
+} // namespace O::Configuration::Application::Detail
+
+inline const O::Configuration::Application::Module_Stats* O::Configuration::Application::Trace_Stats::Find(std::string_view key) const noexcept
+{
+	auto it = std::find_if(modules.begin(), modules.end(), [&](const Module_Stats& stats) { return stats.key == key; });
+	return it == modules.end() ? nullptr : &*it;
+}
+
+inline O::Configuration::Application::Trace_Recorder::Trace_Recorder(Allocation_Probe probe) :
+	probe(probe),
+	origin(std::chrono::steady_clock::now())
+{
+}
+
+inline O::Configuration::Application::Trace_Recorder::Scope O::Configuration::Application::Trace_Recorder::Begin() const
+{
+	// allocations first, so the clock read is the last thing before the step
+	const Allocation_Totals allocations = Allocations();
+	return Scope{ std::chrono::steady_clock::now(), allocations };
+}
+
+inline void O::Configuration::Application::Trace_Recorder::End(const Scope& scope, Phase phase, std::string_view key, std::size_t size)
+{
+	const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	const Allocation_Totals allocations = Allocations();
+
+	using std::chrono::duration_cast;
+	using std::chrono::nanoseconds;
+	events.push_back(Trace_Event{
+		phase,
+		std::string(key),
+		static_cast<std::uint64_t>(duration_cast<nanoseconds>(scope.start - origin).count()),
+		static_cast<std::uint64_t>(duration_cast<nanoseconds>(end - scope.start).count()),
+		allocations.count - scope.allocations.count,
+		allocations.bytes - scope.allocations.bytes,
+		size });
+}
+
+inline const std::vector<O::Configuration::Application::Trace_Event>& O::Configuration::Application::Trace_Recorder::Events() const noexcept
+{
+	return events;
+}
+
+inline O::Configuration::Application::Trace_Stats O::Configuration::Application::Trace_Recorder::Stats() const
+{
+	Trace_Stats stats;
+	for (const Trace_Event& event : events)
+	{
+		if (event.phase == Phase::PARSE)
+		{
+			++stats.parses;
+			stats.parse_ns += event.duration_ns;
+			stats.parse_input_bytes += event.size;
+			stats.parse_allocations += event.allocations;
+			stats.parse_allocated_bytes += event.allocated_bytes;
+			continue;
+		}
+
+		auto it = std::find_if(stats.modules.begin(), stats.modules.end(), [&](const Module_Stats& module) { return module.key == event.key; });
+		Module_Stats& module = it != stats.modules.end() ? *it : stats.modules.emplace_back(Module_Stats{ .key = event.key });
+
+		if (event.phase == Phase::LOAD)
+		{
+			++module.loads;
+			module.load_ns += event.duration_ns;
+			module.input_bytes += event.size;
+		}
+		else
+		{
+			++module.writes;
+			module.write_ns += event.duration_ns;
+			module.output_bytes += event.size;
+		}
+		module.allocations += event.allocations;
+		module.allocated_bytes += event.allocated_bytes;
+	}
+	return stats;
+}
+
+inline void O::Configuration::Application::Trace_Recorder::Clear() noexcept
+{
+	events.clear();
+	origin = std::chrono::steady_clock::now();
+}
+
+inline std::string O::Configuration::Application::Trace_Recorder::Chrome_Trace_JSON() const
+{
+	std::string out;
+	Detail::Chars_Sink<std::string> os(out);
+	rapidjson::Writer<Detail::Chars_Sink<std::string>> writer(os);
+
+	writer.StartObject();
+	writer.Key("traceEvents");
+	writer.StartArray();
+	for (const Trace_Event& event : events)
+	{
+		// complete events, the format counts in microseconds
+		writer.StartObject();
+		writer.Key("name");
+		if (event.phase == Phase::PARSE)
+			writer.String("parse");
+		else
+			writer.String(event.key.data(), static_cast<rapidjson::SizeType>(event.key.size()));
+		writer.Key("cat");
+		writer.String(Detail::Phase_Name(event.phase));
+		writer.Key("ph");
+		writer.String("X");
+		writer.Key("ts");
+		writer.Double(static_cast<double>(event.start_ns) / 1000.0);
+		writer.Key("dur");
+		writer.Double(static_cast<double>(event.duration_ns) / 1000.0);
+		writer.Key("pid");
+		writer.Int(1);
+		writer.Key("tid");
+		writer.Int(1);
+		writer.Key("args");
+		writer.StartObject();
+		writer.Key("size");
+		writer.Uint64(event.size);
+		writer.Key("allocations");
+		writer.Uint64(event.allocations);
+		writer.Key("allocated_bytes");
+		writer.Uint64(event.allocated_bytes);
+		writer.EndObject();
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.Key("displayTimeUnit");
+	writer.String("ns");
+	writer.EndObject();
+	return out;
+}
+
+inline std::optional<O::Configuration::Application::Write_Error> O::Configuration::Application::Trace_Recorder::Write_Chrome_Trace(const std::filesystem::path& path) const
+{
+	const std::string json = Chrome_Trace_JSON();
+
+	const int fd = Detail::Open_For_Writing(path);
+	if (fd < 0)
+		return Write_Error::FILE_OPEN_FAILED;
+
+	std::optional<Write_Error> error = Fd_Sink(fd).Write(json.data(), json.size());
+	if (!Detail::Close_File(fd, false) && !error)
+		error = Write_Error::FILE_WRITE_FAILED;
+	return error;
+}
+
+inline O::Configuration::Application::Allocation_Totals O::Configuration::Application::Trace_Recorder::Allocations() const
+{
+	return probe ? probe() : Allocation_Totals{};
+}
+
+#endif //CONFIGURATION_APPLICATION_TRACE_RECORDER_HPP
@@ -0,0 +1,172 @@
+#ifndef CONFIGURATION_MODULE_BINARY_SERIALIZER_H
+#define CONFIGURATION_MODULE_BINARY_SERIALIZER_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace O::Configuration::Module
+{
+	/**
+	 * @brief Append-only byte buffer used by binary serializers.
+	 *
+	 * Values are written in native byte order, the snapshot header rejects snapshots made on a platform with another layout.
+	 */
+	class Binary_Output
+	{
+	public:
+		explicit Binary_Output(std::vector<char>& buffer) : buffer(buffer) {}
+
+		/**
+		 * @brief Append the bytes of a trivially copyable value.
+		 */
+		template<class T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Binary_Output::Write only accepts trivially copyable types");
+			Write_Bytes(&value, sizeof(T));
+		}
+
+		/**
+		 * @brief Append a string as its size followed by its bytes.
+		 */
+		void Write_String(std::string_view value)
+		{
+			Write<std::uint64_t>(value.size());
+			Write_Bytes(value.data(), value.size());
+		}
+
+		/**
+		 * @brief Append raw bytes.
+		 */
+		void Write_Bytes(const void* data, std::size_t size)
+		{
+			const char* bytes = static_cast<const char*>(data);
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+	private:
+		std::vector<char>& buffer;
+	};
+
+	/**
+	 * @brief Bounds checked reader over the bytes written by Binary_Output.
+	 *
+	 * Every read returns false instead of reading past the end, so a truncated or corrupted snapshot is rejected and not trusted.
+	 */
+	class Binary_Input
+	{
+	public:
+		explicit Binary_Input(std::span<const char> bytes) : bytes(bytes) {}
+
+		/**
+		 * @brief Read the bytes of a trivially copyable value.
+		 */
+		template<class T>
+		bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Binary_Input::Read only accepts trivially copyable types");
+			return Read_Bytes(&value, sizeof(T));
+		}
+
+		/**
+		 * @brief Read a string written by Binary_Output::Write_String.
+		 */
+		bool Read_String(std::string& value)
+		{
+			std::uint64_t size = 0;
+			if (!Read(size) || size > bytes.size())
+				return false;
+			value.assign(bytes.data(), static_cast<std::size_t>(size));
+			bytes = bytes.subspan(static_cast<std::size_t>(size));
+			return true;
+		}
+
+		/**
+		 * @brief Read raw bytes.
+		 */
+		bool Read_Bytes(void* data, std::size_t size)
+		{
+			if (size > bytes.size())
+				return false;
+			std::memcpy(data, bytes.data(), size);
+			bytes = bytes.subspan(size);
+			return true;
+		}
+
+		/**
+		 * @brief Number of bytes left.
+		 */
+		std::size_t Remaining() const noexcept
+		{
+			return bytes.size();
+		}
+
+	private:
+		std::span<const char> bytes;
+	};
+
+	/**
+	 * @brief CRTP base for module binary serializers, used by the application binary snapshots.
+	 *
+	 * @tparam Derived The concrete serializer implementation.
+	 * @tparam Data    The data type this serializer saves and loads.
+	 *
+	 * @details
+	 * The Derived type must implement:
+	 * @code
+	 * void Save(Binary_Output& output, const Data& data) const;
+	 * bool Load(Binary_Input& input, Data& data) const;
+	 * static constexpr const char* Key() noexcept;
+	 * static constexpr std::uint32_t Version() noexcept;
+	 * @endcode
+	 *
+	 * Version() must change whenever the saved format changes, it is part of the layout fingerprint that invalidates older snapshots.
+	 */
+	template<class Derived, class Data>
+	struct Binary_Serializer
+	{
+		/**
+		 * @brief Forwarding adapter that calls the Derived Save implementation.
+		 */
+		void Save(Binary_Output& output, const Data& data) const
+		{
+			static_cast<const Derived*>(this)->Save(output, data);
+		}
+
+		/**
+		 * @brief Forwarding adapter that calls the Derived Load implementation.
+		 *
+		 * @return false when the bytes do not describe a valid Data.
+		 */
+		bool Load(Binary_Input& input, Data& data) const
+		{
+			return static_cast<const Derived*>(this)->Load(input, data);
+		}
+
+		/**
+		 * @brief Return the key of the module.
+		 */
+		static constexpr const char* Key() noexcept
+		{
+			return Derived::Key();
+		}
+
+		/**
+		 * @brief Return the version of the saved format.
+		 */
+		static constexpr std::uint32_t Version() noexcept
+		{
+			return Derived::Version();
+		}
+	};
+
+} // namespace O::Configuration::Module
+
+#endif // CONFIGURATION_MODULE_BINARY_SERIALIZER_H
@@ -0,0 +1,131 @@
+#ifndef CONFIGURATION_MODULE_CONSTANT_VALUE_H
+#define CONFIGURATION_MODULE_CONSTANT_VALUE_H
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace O::Configuration::Module
+{
+	/**
+	 * @brief Value of a Constant_Document, the nodes of a document are stored in document order.
+	 */
+	struct Constant_Node
+	{
+		enum class Type { NULL_VALUE, BOOL, NUMBER, STRING, ARRAY, OBJECT };
+
+		/**
+		 * @brief Integer types holding a NUMBER exactly, as rapidjson reports them with IsInt/IsUint/IsInt64/IsUint64.
+		 */
+		enum Integer_Flags : unsigned { INT = 1, UINT = 2, INT64 = 4, UINT64 = 8 };
+
+		Type type = Type::NULL_VALUE;
+		bool boolean = false;
+		unsigned integer_flags = 0;
+		std::int64_t int64 = 0;
+		std::uint64_t uint64 = 0;
+		double number = 0;
+		std::size_t string_offset = 0; /**< STRING: decoded text in the document characters. */
+		std::size_t string_length = 0;
+		std::size_t name_offset = 0;   /**< Member of an OBJECT: decoded name in the document characters. */
+		std::size_t name_length = 0;
+		std::size_t size = 0;          /**< ARRAY and OBJECT: number of children, they follow the node. */
+		std::size_t extent = 1;        /**< Number of nodes of the subtree, this one included. */
+	};
+
+	/**
+	 * @brief JSON value parsed in a constant expression, the argument of the Load_Constant builder hook.
+	 *
+	 * Mirrors the read interface of rapidjson::Value used by the builders, every member is constexpr.
+	 * The strings are views into the characters of the document, which must outlive them.
+	 */
+	class Constant_Value
+	{
+	public:
+		constexpr Constant_Value(const Constant_Node* node, const char* chars) noexcept : node(node), chars(chars) {}
+
+		constexpr bool Is_Null() const noexcept { return node->type == Constant_Node::Type::NULL_VALUE; }
+		constexpr bool Is_Bool() const noexcept { return node->type == Constant_Node::Type::BOOL; }
+		constexpr bool Is_Number() const noexcept { return node->type == Constant_Node::Type::NUMBER; }
+		constexpr bool Is_Int() const noexcept { return Is_Number() && (node->integer_flags & Constant_Node::INT); }
+		constexpr bool Is_Uint() const noexcept { return Is_Number() && (node->integer_flags & Constant_Node::UINT); }
+		constexpr bool Is_Int64() const noexcept { return Is_Number() && (node->integer_flags & Constant_Node::INT64); }
+		constexpr bool Is_Uint64() const noexcept { return Is_Number() && (node->integer_flags & Constant_Node::UINT64); }
+		constexpr bool Is_Double() const noexcept { return Is_Number() && node->integer_flags == 0; }
+		constexpr bool Is_String() const noexcept { return node->type == Constant_Node::Type::STRING; }
+		constexpr bool Is_Array() const noexcept { return node->type == Constant_Node::Type::ARRAY; }
+		constexpr bool Is_Object() const noexcept { return node->type == Constant_Node::Type::OBJECT; }
+
+		constexpr bool Get_Bool() const noexcept { return node->boolean; }
+		constexpr int Get_Int() const noexcept { return static_cast<int>(node->int64); }
+		constexpr unsigned Get_Uint() const noexcept { return static_cast<unsigned>(node->uint64); }
+		constexpr std::int64_t Get_Int64() const noexcept { return node->int64; }
+		constexpr std::uint64_t Get_Uint64() const noexcept { return node->uint64; }
+		constexpr double Get_Double() const noexcept { return node->number; }
+		constexpr std::string_view Get_String() const noexcept { return std::string_view(chars + node->string_offset, node->string_length); }
+
+		/**
+		 * @brief Number of elements of an array or members of an object.
+		 */
+		constexpr std::size_t Size() const noexcept { return node->size; }
+
+		/**
+		 * @brief Element index of an array, or value of the member index of an object.
+		 */
+		constexpr Constant_Value operator[](std::size_t index) const noexcept;
+
+		/**
+		 * @brief Name of the member index of an object.
+		 */
+		constexpr std::string_view Name(std::size_t index) const noexcept;
+
+		/**
+		 * @brief Value of the first member of an object called name, std::nullopt when there is none.
+		 */
+		constexpr std::optional<Constant_Value> Find(std::string_view name) const noexcept;
+
+	private:
+		constexpr const Constant_Node* Child(std::size_t index) const noexcept;
+
+		const Constant_Node* node;
+		const char* chars;
+	};
+
+	/**
+	 * @brief JSON text parsed in a constant expression.
+	 *
+	 * Strings are decoded into chars, escapes included. Numbers follow the rapidjson rules: integers fitting 64 bits keep their integer flags,
+	 * the others are doubles, correctly rounded up to 2^53 * 10^22 and within a unit in the last place beyond.
+	 *
+	 * @tparam CAPACITY Size of the text, which bounds both the number of values and of decoded characters.
+	 */
+	template<std::size_t CAPACITY>
+	struct Constant_Document
+	{
+		static constexpr std::size_t MAX_DEPTH = 256;
+
+		/**
+		 * @brief Parse json, at most CAPACITY characters. valid is false when it is not a single JSON value surrounded by whitespace.
+		 */
+		static constexpr Constant_Document Parse(std::string_view json);
+
+		/**
+		 * @brief The root value, strings are read from chars (this->chars or a copy of it).
+		 */
+		constexpr Constant_Value Root(const char* chars) const noexcept { return Constant_Value(nodes.data(), chars); }
+
+		std::array<Constant_Node, CAPACITY> nodes{};
+		std::array<char, CAPACITY> chars{};
+		std::size_t node_count = 0;
+		std::size_t char_count = 0;
+		bool valid = false;
+	};
+
+} // namespace O::Configuration::Module
+
+#include "constant_value.hpp"
+
+#endif // CONFIGURATION_MODULE_CONSTANT_VALUE_H
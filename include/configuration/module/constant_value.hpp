@@ -0,0 +1,403 @@
+#ifndef CONFIGURATION_MODULE_CONSTANT_VALUE_HPP
+#define CONFIGURATION_MODULE_CONSTANT_VALUE_HPP
+
+// STL
+#include <limits>
+
+// MODULE
+#include "constant_value.h"
+
+namespace O::Configuration::Module::Detail
+{
+	/**
+	 * @brief Recursive descent JSON parser filling a Constant_Document.
+	 */
+	template<std::size_t CAPACITY>
+	class Constant_Parser
+	{
+	public:
+		constexpr Constant_Parser(std::string_view text, Constant_Document<CAPACITY>& document) : text(text), document(document) {}
+
+		constexpr bool Parse()
+		{
+			Skip_Whitespace();
+			if (!Parse_Value(0))
+				return false;
+			Skip_Whitespace();
+			return position == text.size();
+		}
+
+	private:
+		constexpr void Skip_Whitespace()
+		{
+			while (position < text.size() && (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' || text[position] == '\r'))
+				++position;
+		}
+
+		constexpr bool Consume(char c)
+		{
+			if (position == text.size() || text[position] != c)
+				return false;
+			++position;
+			return true;
+		}
+
+		constexpr bool Parse_Value(std::size_t depth)
+		{
+			if (depth > Constant_Document<CAPACITY>::MAX_DEPTH || position == text.size() || document.node_count == CAPACITY)
+				return false;
+
+			const std::size_t index = document.node_count++;
+			Constant_Node& node = document.nodes[index];
+			bool ok;
+
+			switch (text[position])
+			{
+			case '{': ok = Parse_Container(index, depth, true); break;
+			case '[': ok = Parse_Container(index, depth, false); break;
+			case '"':
+				node.type = Constant_Node::Type::STRING;
+				ok = Parse_String(node.string_offset, node.string_length);
+				break;
+			case 't':
+				node.type = Constant_Node::Type::BOOL;
+				node.boolean = true;
+				ok = Parse_Literal("true");
+				break;
+			case 'f':
+				node.type = Constant_Node::Type::BOOL;
+				ok = Parse_Literal("false");
+				break;
+			case 'n':
+				ok = Parse_Literal("null");
+				break;
+			default:
+				ok = Parse_Number(node);
+				break;
+			}
+
+			document.nodes[index].extent = document.node_count - index;
+			return ok;
+		}
+
+		constexpr bool Parse_Container(std::size_t index, std::size_t depth, bool object)
+		{
+			document.nodes[index].type = object ? Constant_Node::Type::OBJECT : Constant_Node::Type::ARRAY;
+			const char close = object ? '}' : ']';
+			++position;
+
+			Skip_Whitespace();
+			if (Consume(close))
+				return true;
+
+			while (true)
+			{
+				std::size_t name_offset = 0;
+				std::size_t name_length = 0;
+				if (object)
+				{
+					if (position == text.size() || text[position] != '"' || !Parse_String(name_offset, name_length))
+						return false;
+					Skip_Whitespace();
+					if (!Consume(':'))
+						return false;
+					Skip_Whitespace();
+				}
+
+				const std::size_t child = document.node_count;
+				if (!Parse_Value(depth + 1))
+					return false;
+				document.nodes[child].name_offset = name_offset;
+				document.nodes[child].name_length = name_length;
+				++document.nodes[index].size;
+
+				Skip_Whitespace();
+				if (Consume(close))
+					return true;
+				if (!Consume(','))
+					return false;
+				Skip_Whitespace();
+			}
+		}
+
+		constexpr bool Parse_Literal(std::string_view literal)
+		{
+			if (text.substr(position, literal.size()) != literal)
+				return false;
+			position += literal.size();
+			return true;
+		}
+
+		constexpr bool Append(std::uint32_t code_point)
+		{
+			// UTF-8 encoding, never longer than the escape it comes from
+			char bytes[4] = {};
+			std::size_t size;
+			if (code_point < 0x80)
+			{
+				bytes[0] = static_cast<char>(code_point);
+				size = 1;
+			}
+			else if (code_point < 0x800)
+			{
+				bytes[0] = static_cast<char>(0xC0 | (code_point >> 6));
+				bytes[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+				size = 2;
+			}
+			else if (code_point < 0x10000)
+			{
+				bytes[0] = static_cast<char>(0xE0 | (code_point >> 12));
+				bytes[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				bytes[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+				size = 3;
+			}
+			else
+			{
+				bytes[0] = static_cast<char>(0xF0 | (code_point >> 18));
+				bytes[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+				bytes[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				bytes[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+				size = 4;
+			}
+
+			if (document.char_count + size > CAPACITY)
+				return false;
+			for (std::size_t i = 0; i < size; ++i)
+				document.chars[document.char_count++] = bytes[i];
+			return true;
+		}
+
+		constexpr bool Parse_Hex4(std::uint32_t& value)
+		{
+			if (text.size() - position < 4)
+				return false;
+			value = 0;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				const char c = text[position++];
+				value <<= 4;
+				if (c >= '0' && c <= '9')
+					value |= static_cast<std::uint32_t>(c - '0');
+				else if (c >= 'a' && c <= 'f')
+					value |= static_cast<std::uint32_t>(c - 'a' + 10);
+				else if (c >= 'A' && c <= 'F')
+					value |= static_cast<std::uint32_t>(c - 'A' + 10);
+				else
+					return false;
+			}
+			return true;
+		}
+
+		constexpr bool Parse_String(std::size_t& offset, std::size_t& length)
+		{
+			++position;
+			offset = document.char_count;
+
+			while (true)
+			{
+				if (position == text.size())
+					return false;
+
+				const char c = text[position++];
+				if (c == '"')
+					break;
+				if (static_cast<unsigned char>(c) < 0x20)
+					return false;
+				if (c != '\\')
+				{
+					if (document.char_count == CAPACITY)
+						return false;
+					document.chars[document.char_count++] = c;
+					continue;
+				}
+
+				if (position == text.size())
+					return false;
+				std::uint32_t code_point;
+				switch (text[position++])
+				{
+				case '"': code_point = '"'; break;
+				case '\\': code_point = '\\'; break;
+				case '/': code_point = '/'; break;
+				case 'b': code_point = '\b'; break;
+				case 'f': code_point = '\f'; break;
+				case 'n': code_point = '\n'; break;
+				case 'r': code_point = '\r'; break;
+				case 't': code_point = '\t'; break;
+				case 'u':
+				{
+					if (!Parse_Hex4(code_point) || (code_point >= 0xDC00 && code_point <= 0xDFFF))
+						return false;
+					// a high surrogate must be followed by the escaped low one
+					if (code_point >= 0xD800 && code_point <= 0xDBFF)
+					{
+						std::uint32_t low;
+						if (!Parse_Literal("\\u") || !Parse_Hex4(low) || low < 0xDC00 || low > 0xDFFF)
+							return false;
+						code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+					}
+					break;
+				}
+				default:
+					return false;
+				}
+				if (!Append(code_point))
+					return false;
+			}
+
+			length = document.char_count - offset;
+			return true;
+		}
+
+		static constexpr double Scale(std::uint64_t mantissa, int exponent)
+		{
+			constexpr double EXACT_POWERS[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+			// both operands exact, the only rounding is the one of the operation
+			if (mantissa < (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+				return exponent >= 0 ? static_cast<double>(mantissa) * EXACT_POWERS[exponent] : static_cast<double>(mantissa) / EXACT_POWERS[-exponent];
+
+			long double value = static_cast<long double>(mantissa);
+			for (; exponent > 0; --exponent)
+				value *= 10.0L;
+			for (; exponent < 0 && value != 0; ++exponent)
+				value /= 10.0L;
+			return static_cast<double>(value);
+		}
+
+		constexpr bool Parse_Number(Constant_Node& node)
+		{
+			node.type = Constant_Node::Type::NUMBER;
+			const bool negative = Consume('-');
+
+			auto is_digit = [&] { return position < text.size() && text[position] >= '0' && text[position] <= '9'; };
+			if (!is_digit())
+				return false;
+
+			std::uint64_t mantissa = 0;
+			int exponent = 0;
+			bool integer = true;
+			bool overflow = false;
+
+			auto add_digit = [&](char c, bool fraction)
+				{
+					constexpr std::uint64_t MAX = std::numeric_limits<std::uint64_t>::max();
+					const std::uint64_t digit = static_cast<std::uint64_t>(c - '0');
+					if (mantissa < MAX / 10 || (mantissa == MAX / 10 && digit <= MAX % 10))
+					{
+						mantissa = mantissa * 10 + digit;
+						exponent -= fraction ? 1 : 0;
+					}
+					else
+					{
+						// digits past the precision of the mantissa only move the exponent
+						overflow = true;
+						exponent += fraction ? 0 : 1;
+					}
+				};
+
+			if (text[position] == '0')
+				++position;
+			else
+				while (is_digit())
+					add_digit(text[position++], false);
+
+			if (Consume('.'))
+			{
+				integer = false;
+				if (!is_digit())
+					return false;
+				while (is_digit())
+					add_digit(text[position++], true);
+			}
+
+			if (position < text.size() && (text[position] == 'e' || text[position] == 'E'))
+			{
+				++position;
+				integer = false;
+				const bool negative_exponent = Consume('-');
+				if (!negative_exponent)
+					Consume('+');
+				if (!is_digit())
+					return false;
+				int written = 0;
+				while (is_digit())
+				{
+					written = written < 100000 ? written * 10 + (text[position] - '0') : written;
+					++position;
+				}
+				exponent += negative_exponent ? -written : written;
+			}
+
+			constexpr std::uint64_t INT64_MAGNITUDE = std::uint64_t(1) << 63;
+			if (integer && !overflow && (!negative || mantissa <= INT64_MAGNITUDE))
+			{
+				if (negative)
+				{
+					node.int64 = mantissa == INT64_MAGNITUDE ? std::numeric_limits<std::int64_t>::min() : -static_cast<std::int64_t>(mantissa);
+					node.integer_flags = Constant_Node::INT64 | (node.int64 >= std::numeric_limits<int>::min() ? Constant_Node::INT : 0u);
+					node.number = static_cast<double>(node.int64);
+				}
+				else
+				{
+					node.uint64 = mantissa;
+					node.int64 = static_cast<std::int64_t>(mantissa);
+					node.integer_flags = Constant_Node::UINT64
+						| (mantissa < INT64_MAGNITUDE ? Constant_Node::INT64 : 0u)
+						| (mantissa <= std::numeric_limits<unsigned>::max() ? Constant_Node::UINT : 0u)
+						| (mantissa <= static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ? Constant_Node::INT : 0u);
+					node.number = static_cast<double>(mantissa);
+				}
+				return true;
+			}
+
+			const double magnitude = Scale(mantissa, exponent);
+			if (magnitude > std::numeric_limits<double>::max())
+				return false;
+			node.number = negative ? -magnitude : magnitude;
+			return true;
+		}
+
+		std::string_view text;
+		Constant_Document<CAPACITY>& document;
+		std::size_t position = 0;
+	};
+} // namespace O::Configuration::Module::Detail
+
+constexpr const O::Configuration::Module::Constant_Node* O::Configuration::Module::Constant_Value::Child(std::size_t index) const noexcept
+{
+	const Constant_Node* child = node + 1;
+	for (; index != 0; --index)
+		child += child->extent;
+	return child;
+}
+
+constexpr O::Configuration::Module::Constant_Value O::Configuration::Module::Constant_Value::operator[](std::size_t index) const noexcept
+{
+	return Constant_Value(Child(index), chars);
+}
+
+constexpr std::string_view O::Configuration::Module::Constant_Value::Name(std::size_t index) const noexcept
+{
+	const Constant_Node* child = Child(index);
+	return std::string_view(chars + child->name_offset, child->name_length);
+}
+
+constexpr std::optional<O::Configuration::Module::Constant_Value> O::Configuration::Module::Constant_Value::Find(std::string_view name) const noexcept
+{
+	const Constant_Node* child = node + 1;
+	for (std::size_t i = 0; i < node->size; ++i, child += child->extent)
+		if (std::string_view(chars + child->name_offset, child->name_length) == name)
+			return Constant_Value(child, chars);
+	return std::nullopt;
+}
+
+template<std::size_t CAPACITY>
+constexpr O::Configuration::Module::Constant_Document<CAPACITY> O::Configuration::Module::Constant_Document<CAPACITY>::Parse(std::string_view json)
+{
+	Constant_Document document;
+	document.valid = json.size() <= CAPACITY && Detail::Constant_Parser<CAPACITY>(json, document).Parse();
+	return document;
+}
+
+#endif // CONFIGURATION_MODULE_CONSTANT_VALUE_HPP
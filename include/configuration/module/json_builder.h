@@ -6,6 +6,8 @@
 #include <utility>
 #include <type_traits>
 #include <optional>
+#include <memory>
+#include <memory_resource>
 
 // RAPIDJSON
 #include <rapidjson/document.h>
@@ -25,6 +27,13 @@ namespace O::Configuration::Module
 	 * std::optional<Error> Load_From_JSON(const rapidjson::Value& v);
 	 * static constexpr const char* Key() noexcept; // JSON key for this module
 	 * @endcode
+	 * It may also implement, for the Validate_JSON_* entry points:
+	 * @code
+	 * std::optional<Error> Validate_JSON(const rapidjson::Value& v); // same result as Load_From_JSON, without filling data
+	 * @endcode
+	 * To build its data from the memory resource given to Build_From_JSON_*, the Derived type inherits the constructors of this base
+	 * (using JSON_Builder<Derived, Data, Error>::JSON_Builder;). data is then constructed with the resource when Data uses allocators,
+	 * and Load_From_JSON allocates the rest of the data from Resource().
 	 */
 	template<class Derived, class Data, class Error>
 	struct JSON_Builder
@@ -32,6 +41,21 @@ namespace O::Configuration::Module
 		static_assert(std::is_enum_v<Error>, "Each module configuration must define: enum class Error { ... };");
 		static_assert(std::is_same_v<std::underlying_type_t<Error>, int>, "Module::Error must have an underlying type of int.");
 
+		JSON_Builder() = default;
+
+		/**
+		 * @brief Build data from resource.
+		 *
+		 * data is constructed with a std::pmr::polymorphic_allocator of resource when Data uses allocators, default constructed otherwise.
+		 *
+		 * @param resource Memory resource outliving the built data.
+		 */
+		explicit JSON_Builder(std::pmr::memory_resource* resource) :
+			data(std::make_obj_using_allocator<Data>(std::pmr::polymorphic_allocator<>(resource))),
+			resource(resource)
+		{
+		}
+
 		/**
 		 * @brief Invoke the concrete builder's Load_From_JSON implementation.
 		 *
@@ -46,6 +70,19 @@ namespace O::Configuration::Module
 			return static_cast<Derived*>(this)->Load_From_JSON(v);
 		}
 
+		/**
+		 * @brief Check v the way Load_From_JSON does, without keeping the result.
+		 *
+		 * Used by the Application validation entry points. The default runs Load_From_JSON, define Validate_JSON in the concrete builder to skip filling data.
+		 *
+		 * @param v RapidJSON value to check.
+		 * @return std::optional<Error> engaged on error, std::nullopt when Load_From_JSON would succeed.
+		 */
+		std::optional<Error> Validate_JSON(const rapidjson::Value& v)
+		{
+			return static_cast<Derived*>(this)->Load_From_JSON(v);
+		}
+
 		/**
 		 * @brief Move-out the parsed Data object.
 		 *
@@ -68,12 +105,23 @@ namespace O::Configuration::Module
 			return Derived::Key();
 		}
 
+		/**
+		 * @brief Memory resource Load_From_JSON allocates data from, the default resource unless the builder was constructed with one.
+		 */
+		std::pmr::memory_resource* Resource() const noexcept
+		{
+			return resource;
+		}
+
 		/**
 		 * @brief Storage for the parsed data.
 		 *
 		 * The concrete builder populates this member on successful parsing.
 		 */
 		Data data;
+
+	private:
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource();
 	};
 
 } // namespace O::Configuration::Module
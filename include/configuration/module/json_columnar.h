@@ -0,0 +1,365 @@
+#ifndef CONFIGURATION_MODULE_JSON_COLUMNAR_H
+#define CONFIGURATION_MODULE_JSON_COLUMNAR_H
+
+// STL
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MODULE
+#include "json_fields.h"
+#include "json_sax_builder.h"
+#include "json_writer.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Module
+{
+	/**
+	 * @brief Required member of the records of a columnar module, stored in a container of the module data.
+	 *
+	 * @tparam Data      The module data structure.
+	 * @tparam C         Column container (std::vector, std::pmr::vector...), its value_type must have a Field_Type specialization.
+	 * @tparam Error     The module error enumeration.
+	 * @tparam Validator Callable taking a loaded value and returning something convertible to std::optional<Error>.
+	 *
+	 * error is returned when a record misses the member or has the wrong JSON type, validate is called on each loaded value.
+	 */
+	template<class Data, class C, class Error, class Validator = No_Validation>
+	struct Column
+	{
+		using Member = typename C::value_type;
+		static constexpr bool REQUIRED = true;
+
+		std::string_view name;
+		C Data::* member;
+		Error error;
+		Validator validate = {};
+	};
+
+	/**
+	 * @brief Same as Column, a value initialized element is stored for the records missing the member.
+	 */
+	template<class Data, class C, class Error, class Validator = No_Validation>
+	struct Optional_Column
+	{
+		using Member = typename C::value_type;
+		static constexpr bool REQUIRED = false;
+
+		std::string_view name;
+		C Data::* member;
+		Error error;
+		Validator validate = {};
+	};
+
+	/**
+	 * @brief SAX builder of a module whose value is an array of flat records, stored as one container per member (structure of arrays).
+	 *
+	 * @tparam Records Description of the module, it must provide:
+	 * @code
+	 * using Data = <module data, holding the column containers>;
+	 * using Error = <module error enum>;
+	 * static constexpr const char* Key() noexcept;
+	 * static constexpr Error Not_An_Array_Error() noexcept; // the value is not an array of objects
+	 * static constexpr auto Columns() noexcept;             // std::tuple of Column / Optional_Column
+	 * @endcode
+	 * and may provide:
+	 * @code
+	 * static constexpr std::size_t CHUNK_SIZE = <records per chunk>; // DEFAULT_CHUNK_SIZE otherwise
+	 * static std::optional<Error> Validate_Chunk(const Data& data, const Chunk& chunk); // data holds the previous chunks
+	 * @endcode
+	 *
+	 * The records are loaded into a staging chunk of CHUNK_SIZE rows per column, each full chunk is checked by Validate_Chunk and moved at the
+	 * end of the columns. Fed by Build_From_JSON_Stream, the records go from the input to the columns without a DOM: the memory used besides
+	 * the columns is one chunk. Unknown members are ignored, nested values included, and the first occurrence of a duplicated member wins.
+	 * A value of a column that is an object or an array fails with the column error.
+	 */
+	template<class Records>
+	struct JSON_Columnar_Builder : JSON_SAX_Builder<JSON_Columnar_Builder<Records>, typename Records::Data, typename Records::Error>
+	{
+	private:
+		static constexpr auto COLUMNS = Records::Columns();
+		static constexpr std::size_t COUNT = std::tuple_size_v<std::decay_t<decltype(COLUMNS)>>;
+
+		template<std::size_t I>
+		using Member = typename std::decay_t<decltype(std::get<I>(COLUMNS))>::Member;
+
+		template<class Sequence>
+		struct Chunk_Of;
+
+		template<std::size_t... I>
+		struct Chunk_Of<std::index_sequence<I...>>
+		{
+			using Views = std::tuple<std::span<const Member<I>>...>;
+			using Buffers = std::tuple<std::unique_ptr<Member<I>[]>...>;
+		};
+
+	public:
+		using Base = JSON_SAX_Builder<JSON_Columnar_Builder<Records>, typename Records::Data, typename Records::Error>;
+		using Error = typename Records::Error;
+		using Data = typename Records::Data;
+
+		/// Rows of a chunk, one view per column in declaration order.
+		using Chunk = typename Chunk_Of<std::make_index_sequence<COUNT>>::Views;
+
+		static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1024;
+		static constexpr std::size_t CHUNK_SIZE = [] {
+			if constexpr (requires { Records::CHUNK_SIZE; })
+				return Records::CHUNK_SIZE;
+			else
+				return DEFAULT_CHUNK_SIZE;
+		}();
+		static_assert(CHUNK_SIZE > 0, "A chunk must hold at least one record.");
+
+		using Base::Base;
+
+		bool On_Null()                       { return Load_Cell(rapidjson::Value()); }
+		bool On_Bool(bool value)             { return Load_Cell(rapidjson::Value(value)); }
+		bool On_Int(std::int64_t value)      { return Load_Cell(rapidjson::Value(value)); }
+		bool On_Uint(std::uint64_t value)    { return Load_Cell(rapidjson::Value(value)); }
+		bool On_Double(double value)         { return Load_Cell(rapidjson::Value(value)); }
+		bool On_String(std::string_view value)
+		{
+			return Load_Cell(rapidjson::Value(value.data(), static_cast<rapidjson::SizeType>(value.size())));
+		}
+
+		bool On_Key(std::string_view key)
+		{
+			if (skip_depth != 0)
+				return true;
+			current = Column_Index(key, std::make_index_sequence<COUNT>{});
+			if (current != COUNT && seen[current])
+				current = COUNT;
+			return true;
+		}
+
+		bool On_Start_Array()  { return Open(true); }
+		bool On_Start_Object() { return Open(false); }
+		bool On_End_Array()    { return Close(); }
+		bool On_End_Object()   { return Close(); }
+
+		std::optional<Error> Finish_SAX()
+		{
+			if (!started)
+				return Records::Not_An_Array_Error();
+			return Flush_Chunk();
+		}
+
+		static constexpr Error Unexpected_Error() noexcept
+		{
+			return Records::Not_An_Array_Error();
+		}
+
+		static constexpr const char* Key() noexcept
+		{
+			return Records::Key();
+		}
+
+	private:
+		static_assert([]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			const std::array<std::string_view, COUNT> names = { std::get<I>(COLUMNS).name... };
+			for (std::size_t i = 0; i < COUNT; ++i)
+				for (std::size_t j = i + 1; j < COUNT; ++j)
+					if (names[i] == names[j])
+						return false;
+			return true;
+		}(std::make_index_sequence<COUNT>{}), "Column names of a module must be unique.");
+
+		template<std::size_t... I>
+		static constexpr std::size_t Column_Index(std::string_view key, std::index_sequence<I...>)
+		{
+			std::size_t index = COUNT;
+			(void)((key == std::get<I>(COLUMNS).name && (index = I, true)) || ...);
+			return index;
+		}
+
+		bool Open(bool array)
+		{
+			// Depth() counts the container being opened: 1 the module value, 2 a record, 3 a member of a record
+			if (skip_depth != 0)
+				return true;
+
+			if (this->Depth() == 1)
+			{
+				if (!array)
+					return this->Fail(Records::Not_An_Array_Error());
+				started = true;
+				return true;
+			}
+			if (this->Depth() == 2)
+			{
+				if (array)
+					return this->Fail(Records::Not_An_Array_Error());
+				seen = {};
+				current = COUNT;
+				return true;
+			}
+			if (current != COUNT)
+				return Fail_Column(current, std::make_index_sequence<COUNT>{});
+			skip_depth = this->Depth();
+			return true;
+		}
+
+		bool Close()
+		{
+			if (skip_depth != 0)
+			{
+				if (this->Depth() == skip_depth)
+					skip_depth = 0;
+				return true;
+			}
+			if (this->Depth() == 2)
+				return End_Record(std::make_index_sequence<COUNT>{});
+			return true;
+		}
+
+		bool Load_Cell(const rapidjson::Value& v)
+		{
+			if (skip_depth != 0)
+				return true;
+			if (this->Depth() != 2)
+				return this->Fail(Records::Not_An_Array_Error());
+			if (current == COUNT)
+				return true;
+			return Load_Column(v, std::make_index_sequence<COUNT>{});
+		}
+
+		template<std::size_t... I>
+		bool Load_Column(const rapidjson::Value& v, std::index_sequence<I...>)
+		{
+			bool ok = true;
+			(void)((current == I && (ok = Load_Value<I>(v), true)) || ...);
+			return ok;
+		}
+
+		template<std::size_t I>
+		bool Load_Value(const rapidjson::Value& v)
+		{
+			constexpr auto& column = std::get<I>(COLUMNS);
+			Member<I>& target = Staging<I>()[rows];
+
+			seen[I] = true;
+			if (!Field_Type<Member<I>>::Load(v, target))
+				return this->Fail(column.error);
+			if (std::optional<Error> invalid = column.validate(std::as_const(target)))
+				return this->Fail(*invalid);
+			return true;
+		}
+
+		template<std::size_t... I>
+		bool Fail_Column(std::size_t index, std::index_sequence<I...>)
+		{
+			(void)((index == I && (this->Fail(std::get<I>(COLUMNS).error), true)) || ...);
+			return false;
+		}
+
+		template<std::size_t... I>
+		bool End_Record(std::index_sequence<I...>)
+		{
+			bool ok = true;
+			(void)((ok = Complete_Column<I>()) && ...);
+			if (!ok)
+				return false;
+
+			if (++rows == CHUNK_SIZE)
+				if (std::optional<Error> e = Flush_Chunk())
+					return this->Fail(*e);
+			return true;
+		}
+
+		template<std::size_t I>
+		bool Complete_Column()
+		{
+			if (seen[I])
+				return true;
+			if (std::decay_t<decltype(std::get<I>(COLUMNS))>::REQUIRED)
+				return this->Fail(std::get<I>(COLUMNS).error);
+			Staging<I>()[rows] = Member<I>{};
+			return true;
+		}
+
+		template<std::size_t I>
+		Member<I>* Staging()
+		{
+			auto& buffer = std::get<I>(staging);
+			if (!buffer)
+				buffer = std::make_unique<Member<I>[]>(CHUNK_SIZE);
+			return buffer.get();
+		}
+
+		std::optional<Error> Flush_Chunk()
+		{
+			if (rows == 0)
+				return std::nullopt;
+
+			return [&]<std::size_t... I>(std::index_sequence<I...>) -> std::optional<Error>
+			{
+				if constexpr (requires(const Data& data, const Chunk& chunk) { Records::Validate_Chunk(data, chunk); })
+				{
+					const Chunk chunk{ std::span<const Member<I>>(Staging<I>(), rows)... };
+					if (std::optional<Error> invalid = Records::Validate_Chunk(std::as_const(this->data), chunk))
+						return invalid;
+				}
+
+				((this->data.*std::get<I>(COLUMNS).member).insert((this->data.*std::get<I>(COLUMNS).member).end(),
+					std::make_move_iterator(Staging<I>()), std::make_move_iterator(Staging<I>() + rows)), ...);
+				rows = 0;
+				return std::nullopt;
+			}(std::make_index_sequence<COUNT>{});
+		}
+
+		typename Chunk_Of<std::make_index_sequence<COUNT>>::Buffers staging;
+		std::size_t rows = 0;
+		std::array<bool, COUNT> seen{};
+		std::size_t current = COUNT;
+		std::size_t skip_depth = 0;
+		bool started = false;
+	};
+
+	/**
+	 * @brief Module writer generated from the column descriptors of JSON_Columnar_Builder.
+	 *
+	 * Writes the array of records, every column in declaration order. All the columns must hold the same number of elements.
+	 * The values are read from the columns in place: the output stream receives the records as they are written.
+	 */
+	template<class Records>
+	struct JSON_Columnar_Writer : JSON_Writer<JSON_Columnar_Writer<Records>, typename Records::Data>
+	{
+		template<class RapidJSON_Writer>
+		void To_JSON(RapidJSON_Writer& writer, const typename Records::Data& data) const
+		{
+			static constexpr auto COLUMNS = Records::Columns();
+
+			writer.StartArray();
+			const std::size_t rows = (data.*std::get<0>(COLUMNS).member).size();
+			for (std::size_t row = 0; row < rows; ++row)
+			{
+				writer.StartObject();
+				std::apply([&](const auto&... column)
+					{
+						((writer.Key(column.name.data(), static_cast<rapidjson::SizeType>(column.name.size())),
+							Field_Type<typename std::decay_t<decltype(column)>::Member>::Write(writer, (data.*column.member)[row])), ...);
+					}, COLUMNS);
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+
+		static constexpr const char* Key() noexcept
+		{
+			return Records::Key();
+		}
+	};
+
+} // namespace O::Configuration::Module
+
+#endif // CONFIGURATION_MODULE_JSON_COLUMNAR_H
@@ -0,0 +1,375 @@
+#ifndef CONFIGURATION_MODULE_JSON_FIELDS_H
+#define CONFIGURATION_MODULE_JSON_FIELDS_H
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MODULE
+#include "constant_value.h"
+#include "json_builder.h"
+#include "json_writer.h"
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+namespace O::Configuration::Module
+{
+	/**
+	 * @brief Validator of the fields declared without one, accepts every value.
+	 */
+	struct No_Validation
+	{
+		template<class T>
+		constexpr std::nullopt_t operator()(const T&) const noexcept
+		{
+			return std::nullopt;
+		}
+	};
+
+	/**
+	 * @brief Required member of a module JSON object, bound to a data member.
+	 *
+	 * @tparam Data      The module data structure.
+	 * @tparam M         Type of the data member, must have a Field_Type specialization.
+	 * @tparam Error     The module error enumeration.
+	 * @tparam Validator Callable taking the loaded value and returning something convertible to std::optional<Error>.
+	 *
+	 * error is returned when the member is missing or has the wrong JSON type, validate is called once the value is loaded.
+	 */
+	template<class Data, class M, class Error, class Validator = No_Validation>
+	struct Field
+	{
+		using Member = M;
+		static constexpr bool REQUIRED = true;
+
+		std::string_view name;
+		M Data::* member;
+		Error error;
+		Validator validate = {};
+	};
+
+	/**
+	 * @brief Same as Field, the data member keeps its default value when the JSON member is missing.
+	 */
+	template<class Data, class M, class Error, class Validator = No_Validation>
+	struct Optional_Field
+	{
+		using Member = M;
+		static constexpr bool REQUIRED = false;
+
+		std::string_view name;
+		M Data::* member;
+		Error error;
+		Validator validate = {};
+	};
+
+	/**
+	 * @brief Conversion between a JSON value and a field type, specialize it to bind other member types.
+	 *
+	 * The specialization must provide:
+	 * @code
+	 * static bool Load(const rapidjson::Value& v, T& value); // false when v has the wrong type
+	 * template<class RapidJSON_Writer> static void Write(RapidJSON_Writer& writer, const T& value);
+	 * @endcode
+	 * It may also provide, used by Validate_JSON for the fields without validator so the value is not copied:
+	 * @code
+	 * static bool Matches(const rapidjson::Value& v); // same result as Load
+	 * @endcode
+	 * and, used by JSON_Fields_Builder::Load_Constant for the configurations embedded at compile time:
+	 * @code
+	 * static constexpr bool Load_Constant(const Constant_Value& v, T& value); // same result as Load
+	 * @endcode
+	 */
+	template<class T>
+	struct Field_Type;
+
+	template<>
+	struct Field_Type<bool>
+	{
+		static bool Load(const rapidjson::Value& v, bool& value) { if (!v.IsBool()) return false; value = v.GetBool(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, bool& value) { if (!v.Is_Bool()) return false; value = v.Get_Bool(); return true; }
+		template<class W> static void Write(W& writer, bool value) { writer.Bool(value); }
+	};
+
+	template<>
+	struct Field_Type<int>
+	{
+		static bool Load(const rapidjson::Value& v, int& value) { if (!v.IsInt()) return false; value = v.GetInt(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, int& value) { if (!v.Is_Int()) return false; value = v.Get_Int(); return true; }
+		template<class W> static void Write(W& writer, int value) { writer.Int(value); }
+	};
+
+	template<>
+	struct Field_Type<unsigned>
+	{
+		static bool Load(const rapidjson::Value& v, unsigned& value) { if (!v.IsUint()) return false; value = v.GetUint(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, unsigned& value) { if (!v.Is_Uint()) return false; value = v.Get_Uint(); return true; }
+		template<class W> static void Write(W& writer, unsigned value) { writer.Uint(value); }
+	};
+
+	template<>
+	struct Field_Type<std::int64_t>
+	{
+		static bool Load(const rapidjson::Value& v, std::int64_t& value) { if (!v.IsInt64()) return false; value = v.GetInt64(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, std::int64_t& value) { if (!v.Is_Int64()) return false; value = v.Get_Int64(); return true; }
+		template<class W> static void Write(W& writer, std::int64_t value) { writer.Int64(value); }
+	};
+
+	template<>
+	struct Field_Type<std::uint64_t>
+	{
+		static bool Load(const rapidjson::Value& v, std::uint64_t& value) { if (!v.IsUint64()) return false; value = v.GetUint64(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, std::uint64_t& value) { if (!v.Is_Uint64()) return false; value = v.Get_Uint64(); return true; }
+		template<class W> static void Write(W& writer, std::uint64_t value) { writer.Uint64(value); }
+	};
+
+	template<>
+	struct Field_Type<double>
+	{
+		static bool Load(const rapidjson::Value& v, double& value) { if (!v.IsNumber()) return false; value = v.GetDouble(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, double& value) { if (!v.Is_Number()) return false; value = v.Get_Double(); return true; }
+		template<class W> static void Write(W& writer, double value) { writer.Double(value); }
+	};
+
+	template<>
+	struct Field_Type<float>
+	{
+		static bool Load(const rapidjson::Value& v, float& value) { if (!v.IsNumber()) return false; value = v.GetFloat(); return true; }
+		static constexpr bool Load_Constant(const Constant_Value& v, float& value) { if (!v.Is_Number()) return false; value = static_cast<float>(v.Get_Double()); return true; }
+		template<class W> static void Write(W& writer, float value) { writer.Double(value); }
+	};
+
+	template<>
+	struct Field_Type<std::string>
+	{
+		static bool Load(const rapidjson::Value& v, std::string& value) { if (!v.IsString()) return false; value.assign(v.GetString(), v.GetStringLength()); return true; }
+		static bool Matches(const rapidjson::Value& v) { return v.IsString(); }
+		template<class W> static void Write(W& writer, const std::string& value) { writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size())); }
+	};
+
+	template<>
+	struct Field_Type<std::pmr::string>
+	{
+		// assigned in place, the string keeps the allocator of the module data
+		static bool Load(const rapidjson::Value& v, std::pmr::string& value) { if (!v.IsString()) return false; value.assign(v.GetString(), v.GetStringLength()); return true; }
+		static bool Matches(const rapidjson::Value& v) { return v.IsString(); }
+		template<class W> static void Write(W& writer, const std::pmr::string& value) { writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size())); }
+	};
+
+	template<>
+	struct Field_Type<std::string_view>
+	{
+		// only loaded at compile time, the view points into the characters of the embedded configuration
+		static constexpr bool Load_Constant(const Constant_Value& v, std::string_view& value) { if (!v.Is_String()) return false; value = v.Get_String(); return true; }
+		template<class W> static void Write(W& writer, std::string_view value) { writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size())); }
+	};
+
+	/**
+	 * @brief Module builder generated from a list of field descriptors.
+	 *
+	 * @tparam Fields Description of the module, it must provide:
+	 * @code
+	 * using Data = <module data>;
+	 * using Error = <module error enum>;
+	 * static constexpr const char* Key() noexcept;
+	 * static constexpr Error Not_An_Object_Error() noexcept;
+	 * static constexpr auto Fields() noexcept; // std::tuple of Field / Optional_Field
+	 * @endcode
+	 *
+	 * The members of the object are visited once, each one is matched against the field names and loaded in place.
+	 * Unknown members are ignored and the first occurrence of a duplicated member wins.
+	 * The reported error is the one of the first field, in declaration order, that is missing, has the wrong type or fails its validator.
+	 */
+	template<class Fields>
+	struct JSON_Fields_Builder : JSON_Builder<JSON_Fields_Builder<Fields>, typename Fields::Data, typename Fields::Error>
+	{
+		using Error = typename Fields::Error;
+
+		using JSON_Builder<JSON_Fields_Builder<Fields>, typename Fields::Data, typename Fields::Error>::JSON_Builder;
+
+		std::optional<Error> Load_From_JSON(const rapidjson::Value& v)
+		{
+			return Visit<false>(v);
+		}
+
+		/**
+		 * @brief Same checks as Load_From_JSON, the values are loaded into temporaries only when a validator needs them.
+		 */
+		std::optional<Error> Validate_JSON(const rapidjson::Value& v)
+		{
+			return Visit<true>(v);
+		}
+
+		/**
+		 * @brief Same checks and result as Load_From_JSON on a value parsed at compile time, see Application::Build_From_JSON_Constant.
+		 */
+		static constexpr std::optional<Error> Load_Constant(const Constant_Value& v, typename Fields::Data& data)
+		{
+			if (!v.Is_Object())
+				return Fields::Not_An_Object_Error();
+
+			std::optional<Error> error;
+			[&]<std::size_t... I>(std::index_sequence<I...>)
+			{
+				(void)((Load_Constant_Field<I>(v, data, error), !error) && ...);
+			}(std::make_index_sequence<COUNT>{});
+			return error;
+		}
+
+		static constexpr const char* Key() noexcept
+		{
+			return Fields::Key();
+		}
+
+	private:
+		static constexpr auto FIELDS = Fields::Fields();
+		static constexpr std::size_t COUNT = std::tuple_size_v<std::decay_t<decltype(FIELDS)>>;
+
+		static_assert([]<std::size_t... I>(std::index_sequence<I...>)
+		{
+			const std::array<std::string_view, COUNT> names = { std::get<I>(FIELDS).name... };
+			for (std::size_t i = 0; i < COUNT; ++i)
+				for (std::size_t j = i + 1; j < COUNT; ++j)
+					if (names[i] == names[j])
+						return false;
+			return true;
+		}(std::make_index_sequence<COUNT>{}), "Field names of a module must be unique.");
+
+		struct State
+		{
+			std::array<bool, COUNT> seen{};
+			std::size_t error_index = COUNT;
+			std::optional<Error> error;
+
+			void Fail(std::size_t index, Error e)
+			{
+				error_index = index;
+				error = e;
+			}
+		};
+
+		template<bool VALIDATE_ONLY>
+		std::optional<Error> Visit(const rapidjson::Value& v)
+		{
+			if (!v.IsObject())
+				return Fields::Not_An_Object_Error();
+
+			State state;
+			for (auto member = v.MemberBegin(); member != v.MemberEnd(); ++member)
+				Dispatch<VALIDATE_ONLY>(std::string_view(member->name.GetString(), member->name.GetStringLength()), member->value, state, std::make_index_sequence<COUNT>{});
+
+			Check_Required(state, std::make_index_sequence<COUNT>{});
+			return state.error;
+		}
+
+		template<bool VALIDATE_ONLY, std::size_t... I>
+		void Dispatch(std::string_view name, const rapidjson::Value& value, State& state, std::index_sequence<I...>)
+		{
+			(void)((name == std::get<I>(FIELDS).name && (Load_Field<VALIDATE_ONLY, I>(value, state), true)) || ...);
+		}
+
+		template<bool VALIDATE_ONLY, std::size_t I>
+		void Load_Field(const rapidjson::Value& value, State& state)
+		{
+			if (state.seen[I])
+				return;
+			state.seen[I] = true;
+
+			// a later field cannot change the reported error
+			if (I > state.error_index)
+				return;
+
+			constexpr auto& field = std::get<I>(FIELDS);
+			using Member = typename std::decay_t<decltype(field)>::Member;
+
+			if constexpr (VALIDATE_ONLY && std::is_same_v<std::decay_t<decltype(field.validate)>, No_Validation> && requires { Field_Type<Member>::Matches(value); })
+			{
+				if (!Field_Type<Member>::Matches(value))
+					return state.Fail(I, field.error);
+			}
+			else if constexpr (VALIDATE_ONLY)
+			{
+				Member temporary{};
+				Load_Value<I>(value, temporary, state);
+			}
+			else
+			{
+				Load_Value<I>(value, this->data.*field.member, state);
+			}
+		}
+
+		template<std::size_t I, class Member>
+		static void Load_Value(const rapidjson::Value& value, Member& target, State& state)
+		{
+			constexpr auto& field = std::get<I>(FIELDS);
+
+			if (!Field_Type<Member>::Load(value, target))
+				return state.Fail(I, field.error);
+			if (std::optional<Error> invalid = field.validate(std::as_const(target)))
+				return state.Fail(I, *invalid);
+		}
+
+		template<std::size_t I>
+		static constexpr void Load_Constant_Field(const Constant_Value& v, typename Fields::Data& data, std::optional<Error>& error)
+		{
+			constexpr auto& field = std::get<I>(FIELDS);
+			using Member = typename std::decay_t<decltype(field)>::Member;
+			static_assert(requires(const Constant_Value& c, Member& m) { Field_Type<Member>::Load_Constant(c, m); }, "The Field_Type of the member must define Load_Constant to be loaded at compile time.");
+
+			const std::optional<Constant_Value> value = v.Find(field.name);
+			if (!value)
+			{
+				if (std::decay_t<decltype(field)>::REQUIRED)
+					error = field.error;
+				return;
+			}
+
+			if (!Field_Type<Member>::Load_Constant(*value, data.*field.member))
+				error = field.error;
+			else if (std::optional<Error> invalid = field.validate(std::as_const(data.*field.member)))
+				error = *invalid;
+		}
+
+		template<std::size_t... I>
+		static void Check_Required(State& state, std::index_sequence<I...>)
+		{
+			(void)(((std::decay_t<decltype(std::get<I>(FIELDS))>::REQUIRED && !state.seen[I] && I < state.error_index && (state.Fail(I, std::get<I>(FIELDS).error), true)) || ...));
+		}
+	};
+
+	/**
+	 * @brief Module writer generated from the field descriptors of JSON_Fields_Builder, every field is written in declaration order.
+	 */
+	template<class Fields>
+	struct JSON_Fields_Writer : JSON_Writer<JSON_Fields_Writer<Fields>, typename Fields::Data>
+	{
+		template<class RapidJSON_Writer>
+		void To_JSON(RapidJSON_Writer& writer, const typename Fields::Data& data) const
+		{
+			writer.StartObject();
+			std::apply([&](const auto&... field)
+				{
+					((writer.Key(field.name.data(), static_cast<rapidjson::SizeType>(field.name.size())),
+						Field_Type<typename std::decay_t<decltype(field)>::Member>::Write(writer, data.*field.member)), ...);
+				}, Fields::Fields());
+			writer.EndObject();
+		}
+
+		static constexpr const char* Key() noexcept
+		{
+			return Fields::Key();
+		}
+	};
+
+} // namespace O::Configuration::Module
+
+#endif // CONFIGURATION_MODULE_JSON_FIELDS_H
@@ -0,0 +1,152 @@
+#ifndef CONFIGURATION_MODULE_JSON_SAX_BUILDER_H
+#define CONFIGURATION_MODULE_JSON_SAX_BUILDER_H
+
+// STL
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+// RAPIDJSON
+#include <rapidjson/document.h>
+
+// MODULE
+#include "json_builder.h"
+
+namespace O::Configuration::Module
+{
+	/**
+	 * @brief CRTP base for per-module builders fed with SAX events.
+	 *
+	 * @tparam Derived The concrete builder type implementing the event hooks.
+	 * @tparam Data    The module's configuration data structure (movable).
+	 * @tparam Error   An enumeration type (underlying type must be int) describing parse errors.
+	 *
+	 * @details
+	 * A SAX builder receives the events of its module value one by one instead of a rapidjson::Value, so the application can stream the document
+	 * without building a DOM. The same builder keeps working with the DOM entry points: Load_From_JSON replays the value through the hooks.
+	 *
+	 * The Derived type must implement:
+	 * @code
+	 * static constexpr const char* Key() noexcept;            // JSON key for this module
+	 * static constexpr Error Unexpected_Error() noexcept;     // returned for events the builder does not handle
+	 * @endcode
+	 * and may override any of the following hooks (the default implementation fails with Unexpected_Error()):
+	 * @code
+	 * bool On_Null();
+	 * bool On_Bool(bool value);
+	 * bool On_Int(std::int64_t value);    // default forwards to On_Double
+	 * bool On_Uint(std::uint64_t value);  // default forwards to On_Int when representable, On_Double otherwise
+	 * bool On_Double(double value);
+	 * bool On_String(std::string_view value);
+	 * bool On_Key(std::string_view key);
+	 * bool On_Start_Object();
+	 * bool On_End_Object();
+	 * bool On_Start_Array();
+	 * bool On_End_Array();
+	 * std::optional<Error> Finish_SAX();  // called once the whole value was received, default succeeds
+	 * @endcode
+	 * A hook reports an error by returning Fail(error). Depth() gives the number of containers currently open (1 inside the module object).
+	 */
+	template<class Derived, class Data, class Error>
+	struct JSON_SAX_Builder : public JSON_Builder<Derived, Data, Error>
+	{
+		/// Handler type the application forwards the rapidjson events to.
+		using SAX_Handler = JSON_SAX_Builder;
+
+		using JSON_Builder<Derived, Data, Error>::JSON_Builder;
+		using JSON_Builder<Derived, Data, Error>::Key;
+
+		/**
+		 * @brief DOM entry point, replays the value as SAX events.
+		 *
+		 * @param v RapidJSON value to parse.
+		 * @return std::optional<Error> engaged on error, std::nullopt on success.
+		 */
+		std::optional<Error> Load_From_JSON(const rapidjson::Value& v)
+		{
+			v.Accept(*this);
+			return End_SAX();
+		}
+
+		/**
+		 * @brief Terminate the event sequence and return the parse result.
+		 *
+		 * @return std::optional<Error> the first error raised by a hook, otherwise the result of Finish_SAX().
+		 */
+		std::optional<Error> End_SAX()
+		{
+			if (error)
+				return error;
+			return Self().Finish_SAX();
+		}
+
+		//rapidjson handler concept
+		bool Null()                                                        { return Self().On_Null(); }
+		bool Bool(bool b)                                                  { return Self().On_Bool(b); }
+		bool Int(int i)                                                    { return Self().On_Int(i); }
+		bool Uint(unsigned u)                                              { return Self().On_Uint(u); }
+		bool Int64(std::int64_t i)                                         { return Self().On_Int(i); }
+		bool Uint64(std::uint64_t u)                                       { return Self().On_Uint(u); }
+		bool Double(double d)                                              { return Self().On_Double(d); }
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool)  { return Self().On_String(std::string_view(str, length)); }
+		bool String(const char* str, rapidjson::SizeType length, bool)     { return Self().On_String(std::string_view(str, length)); }
+		bool Key(const char* str, rapidjson::SizeType length, bool)        { return Self().On_Key(std::string_view(str, length)); }
+		bool StartObject()                                                 { ++depth; return Self().On_Start_Object(); }
+		bool EndObject(rapidjson::SizeType)                                { bool ok = Self().On_End_Object(); --depth; return ok; }
+		bool StartArray()                                                  { ++depth; return Self().On_Start_Array(); }
+		bool EndArray(rapidjson::SizeType)                                 { bool ok = Self().On_End_Array(); --depth; return ok; }
+
+		//default hooks
+		bool On_Null()                    { return Fail(Derived::Unexpected_Error()); }
+		bool On_Bool(bool)                { return Fail(Derived::Unexpected_Error()); }
+		bool On_Int(std::int64_t i)       { return Self().On_Double(static_cast<double>(i)); }
+		bool On_Uint(std::uint64_t u)
+		{
+			if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+				return Self().On_Int(static_cast<std::int64_t>(u));
+			return Self().On_Double(static_cast<double>(u));
+		}
+		bool On_Double(double)            { return Fail(Derived::Unexpected_Error()); }
+		bool On_String(std::string_view)  { return Fail(Derived::Unexpected_Error()); }
+		bool On_Key(std::string_view)     { return Fail(Derived::Unexpected_Error()); }
+		bool On_Start_Object()            { return Fail(Derived::Unexpected_Error()); }
+		bool On_End_Object()              { return true; }
+		bool On_Start_Array()             { return Fail(Derived::Unexpected_Error()); }
+		bool On_End_Array()               { return true; }
+		std::optional<Error> Finish_SAX() { return std::nullopt; }
+
+	protected:
+		/**
+		 * @brief Record an error and stop the event sequence.
+		 *
+		 * @return false so a hook can `return Fail(error);`
+		 */
+		bool Fail(Error e)
+		{
+			if (!error)
+				error = e;
+			return false;
+		}
+
+		/**
+		 * @brief Number of containers currently open inside the module value.
+		 */
+		std::size_t Depth() const noexcept
+		{
+			return depth;
+		}
+
+	private:
+		Derived& Self()
+		{
+			return static_cast<Derived&>(*this);
+		}
+
+		std::optional<Error> error;
+		std::size_t depth = 0;
+	};
+
+} // namespace O::Configuration::Module
+
+#endif // CONFIGURATION_MODULE_JSON_SAX_BUILDER_H
@@ -13,6 +13,10 @@ namespace O::Configuration::Module
 	 * - `using Builder = <builder type>`; // builder must be compatible with JSON_Builder
 	 * - `using Writer  = <writer type>`;  // writer must be compatible with JSON_Writer
 	 *
+	 * It may also provide:
+	 * - `using Binary  = <serializer type>`; // serializer must be compatible with Binary_Serializer, needed by the binary snapshots
+	 * - `using Hasher  = <hasher type>`;     // `template<class W> void Hash(W& writer, const Data& data) const` writing the events of Fingerprint() only, the Writer is used otherwise
+	 *
 	 * The Application relies on these aliases to obtain the appropriate parser/serializer for each module knowing the base class.
 	 * It create an indirection toward Configuration_Data <-> Configuration parser/serializer
 	 */
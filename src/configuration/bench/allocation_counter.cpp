@@ -0,0 +1,83 @@
+// allocation_counter.cpp
+
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void Count(std::size_t size) noexcept
+    {
+        Allocation_Counter::count.fetch_add(1, std::memory_order_relaxed);
+        Allocation_Counter::bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+#if defined(__GLIBC__)
+
+// rapidjson allocates through std::malloc, interposing the C allocator counts the Document pools as well as operator new
+
+extern "C"
+{
+    void* __libc_malloc(std::size_t size);
+    void* __libc_calloc(std::size_t count, std::size_t size);
+    void* __libc_realloc(void* p, std::size_t size);
+
+    void* malloc(std::size_t size)
+    {
+        Count(size);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(std::size_t count, std::size_t size)
+    {
+        Count(count * size);
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* p, std::size_t size)
+    {
+        Count(size);
+        return __libc_realloc(p, size);
+    }
+}
+
+#else
+
+// only operator new is counted, the C allocations of rapidjson are not
+
+void* operator new(std::size_t size)
+{
+    Count(size);
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef SRC_CONFIGURATION_BENCH_ALLOCATION_COUNTER_H
+#define SRC_CONFIGURATION_BENCH_ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Heap allocations made since the start of the program, see allocation_counter.cpp for what is counted on each platform.
+ */
+struct Allocation_Counter
+{
+    static inline std::atomic<std::size_t> count{ 0 };
+    static inline std::atomic<std::size_t> bytes{ 0 };
+};
+
+/**
+ * @brief Report the allocations made by the timed loop of a benchmark as per iteration counters.
+ *
+ * @code
+ * Allocation_Report report(state);
+ * for (auto _ : state) { ... }
+ * @endcode
+ */
+class Allocation_Report
+{
+public:
+    explicit Allocation_Report(benchmark::State& state) :
+        state(state),
+        count(Allocation_Counter::count.load(std::memory_order_relaxed)),
+        bytes(Allocation_Counter::bytes.load(std::memory_order_relaxed))
+    {
+    }
+
+    ~Allocation_Report()
+    {
+        state.counters["allocs/build"] = benchmark::Counter(static_cast<double>(Allocation_Counter::count.load(std::memory_order_relaxed) - count), benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes/build"] = benchmark::Counter(static_cast<double>(Allocation_Counter::bytes.load(std::memory_order_relaxed) - bytes), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& state;
+    std::size_t count;
+    std::size_t bytes;
+};
+
+#endif //SRC_CONFIGURATION_BENCH_ALLOCATION_COUNTER_H
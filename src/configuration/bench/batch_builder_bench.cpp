@@ -0,0 +1,60 @@
+// batch_builder_bench.cpp
+
+#include "synthetic_structure.h"
+
+#include "configuration/application/batch_builder.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/application/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    // one small tenant configuration per line
+    std::string Tenants_NDJSON(std::size_t tenant_count)
+    {
+        std::string ndjson;
+        for (std::size_t i = 0; i < tenant_count; ++i)
+        {
+            std::string json = Make_Synthetic_Json(4, Synthetic_Shape{ 1, 8, 50 });
+            std::erase(json, '\n');
+            ndjson += json + "\n";
+        }
+        return ndjson;
+    }
+}
+
+static void BM_Tenants_One_By_One(benchmark::State& state)
+{
+    const std::string ndjson = Tenants_NDJSON(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::vector<Expected_Builder<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>>> results;
+        std::size_t begin = 0;
+        for (std::size_t end = ndjson.find('\n'); end != std::string::npos; begin = end + 1, end = ndjson.find('\n', begin))
+            results.push_back(Build_From_JSON_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>>(std::string_view(ndjson).substr(begin, end - begin)));
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(ndjson.size()));
+}
+
+static void BM_Tenants_NDJSON_Batch(benchmark::State& state)
+{
+    const std::string ndjson = Tenants_NDJSON(static_cast<std::size_t>(state.range(0)));
+    Thread_Pool pool(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        auto results = Build_From_NDJSON_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>>(ndjson, pool);
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(ndjson.size()));
+}
+
+BENCHMARK(BM_Tenants_One_By_One)->ArgName("tenants")->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Tenants_NDJSON_Batch)->ArgNames({ "tenants", "threads" })->Args({ 1000, 0 })->Args({ 1000, 4 })->Unit(benchmark::kMillisecond)->UseRealTime();
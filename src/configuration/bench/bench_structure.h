@@ -0,0 +1,121 @@
+#ifndef SRC_CONFIGURATION_BENCH_BENCH_STRUCTURE_H
+#define SRC_CONFIGURATION_BENCH_BENCH_STRUCTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "configuration/module/binary_serializer.h"
+#include "configuration/module/json_builder.h"
+#include "configuration/module/traits.h"
+
+#include <rapidjson/document.h>
+
+struct Route
+{
+    std::string prefix;
+    std::string next_hop;
+    int length = 0;
+    int metric = 0;
+};
+
+struct Route_Table
+{
+    std::vector<Route> routes;
+};
+
+enum class Route_Table_Error
+{
+    SHOULD_BE_AN_OBJECT,
+    ROUTES_SHOULD_BE_AN_ARRAY,
+    INVALID_ROUTE
+};
+
+struct Route_Table_Builder : O::Configuration::Module::JSON_Builder<Route_Table_Builder, Route_Table, Route_Table_Error>
+{
+    static constexpr const char* Key() noexcept { return "route_table"; }
+
+    std::optional<Route_Table_Error> Load_From_JSON(const rapidjson::Value& v)
+    {
+        if (!v.IsObject())
+            return Route_Table_Error::SHOULD_BE_AN_OBJECT;
+        auto routes = v.FindMember("routes");
+        if (routes == v.MemberEnd() || !routes->value.IsArray())
+            return Route_Table_Error::ROUTES_SHOULD_BE_AN_ARRAY;
+
+        data.routes.reserve(routes->value.Size());
+        for (const rapidjson::Value& r : routes->value.GetArray())
+        {
+            if (!r.IsObject() || !r.HasMember("prefix") || !r.HasMember("next_hop") || !r.HasMember("length") || !r.HasMember("metric"))
+                return Route_Table_Error::INVALID_ROUTE;
+            data.routes.push_back(Route{
+                std::string(r["prefix"].GetString(), r["prefix"].GetStringLength()),
+                std::string(r["next_hop"].GetString(), r["next_hop"].GetStringLength()),
+                r["length"].GetInt(),
+                r["metric"].GetInt() });
+        }
+        return std::nullopt;
+    }
+};
+
+struct Route_Table_Binary : O::Configuration::Module::Binary_Serializer<Route_Table_Binary, Route_Table>
+{
+    static constexpr const char* Key() noexcept { return "route_table"; }
+    static constexpr std::uint32_t Version() noexcept { return 1; }
+
+    void Save(O::Configuration::Module::Binary_Output& output, const Route_Table& data) const
+    {
+        output.Write<std::uint64_t>(data.routes.size());
+        for (const Route& route : data.routes)
+        {
+            output.Write_String(route.prefix);
+            output.Write_String(route.next_hop);
+            output.Write(route.length);
+            output.Write(route.metric);
+        }
+    }
+
+    bool Load(O::Configuration::Module::Binary_Input& input, Route_Table& data) const
+    {
+        std::uint64_t count = 0;
+        if (!input.Read(count) || count > input.Remaining())
+            return false;
+        data.routes.resize(static_cast<std::size_t>(count));
+        for (Route& route : data.routes)
+            if (!input.Read_String(route.prefix) || !input.Read_String(route.next_hop) || !input.Read(route.length) || !input.Read(route.metric))
+                return false;
+        return true;
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Route_Table>
+{
+    using Builder = Route_Table_Builder;
+    using Binary = Route_Table_Binary;
+};
+
+/**
+ * @brief Write a route table configuration of route_count entries and return its path.
+ */
+inline std::filesystem::path Write_Route_Table_File(std::size_t route_count)
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("bench_route_table_" + std::to_string(route_count) + ".json");
+    std::ofstream ofs(path, std::ios::binary);
+    ofs << "{\n  \"route_table\": {\n    \"routes\": [\n";
+    for (std::size_t i = 0; i < route_count; ++i)
+    {
+        ofs << "      { \"prefix\": \"10." << (i >> 16) % 256 << '.' << (i >> 8) % 256 << '.' << i % 256
+            << "\", \"length\": " << 16 + i % 17
+            << ", \"next_hop\": \"192.168." << i % 256 << ".1\", \"metric\": " << i % 100 << " }"
+            << (i + 1 == route_count ? "\n" : ",\n");
+    }
+    ofs << "    ]\n  }\n}\n";
+    return path;
+}
+
+#endif //SRC_CONFIGURATION_BENCH_BENCH_STRUCTURE_H
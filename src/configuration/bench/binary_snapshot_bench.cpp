@@ -0,0 +1,62 @@
+// binary_snapshot_bench.cpp
+
+#include "bench_structure.h"
+
+#include "configuration/application/binary_snapshot.h"
+#include "configuration/application/json_builder.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+
+using namespace O::Configuration::Application;
+
+static void BM_Startup_JSON(benchmark::State& state)
+{
+    const std::size_t route_count = static_cast<std::size_t>(state.range(0));
+    const std::filesystem::path path = Write_Route_Table_File(route_count);
+
+    for (auto _ : state)
+    {
+        auto expected = Build_From_JSON_File<Route_Table>(path, Read_Mode::MEMORY_MAPPED);
+        if (!expected.Has_Value() || expected.Value().Get<Route_Table>().routes.size() != route_count)
+        {
+            state.SkipWithError("build failed");
+            break;
+        }
+        benchmark::DoNotOptimize(expected);
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+static void BM_Startup_Binary_Snapshot(benchmark::State& state)
+{
+    const std::size_t route_count = static_cast<std::size_t>(state.range(0));
+    const std::filesystem::path path = Write_Route_Table_File(route_count);
+    std::filesystem::path snapshot_path = path;
+    snapshot_path += ".snapshot";
+
+    // the first build writes the snapshot, every iteration then loads it
+    if (!Build_From_JSON_File_Cached<Route_Table>(path, snapshot_path).Has_Value())
+        state.SkipWithError("build failed");
+
+    for (auto _ : state)
+    {
+        auto expected = Build_From_JSON_File_Cached<Route_Table>(path, snapshot_path);
+        if (!expected.Has_Value() || expected.Value().Get<Route_Table>().routes.size() != route_count)
+        {
+            state.SkipWithError("build failed");
+            break;
+        }
+        benchmark::DoNotOptimize(expected);
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    std::filesystem::remove(snapshot_path, ec);
+}
+
+BENCHMARK(BM_Startup_JSON)->RangeMultiplier(16)->Range(1 << 8, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Startup_Binary_Snapshot)->RangeMultiplier(16)->Range(1 << 8, 1 << 18)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,85 @@
+// cbor_bench.cpp
+
+#include "allocation_counter.h"
+#include "synthetic_structure.h"
+
+#include "configuration/application/cbor.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+#include "configuration/application/parse_context.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    using Synthetic_8 = Container<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>, Synthetic<4>, Synthetic<5>, Synthetic<6>, Synthetic<7>>;
+
+    Synthetic_8 Make_Synthetic_Container(const benchmark::State& state)
+    {
+        const std::string json = Make_Synthetic_Json(8, Synthetic_Shape{ static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(2)) });
+        auto expected = Build_From_JSON_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>, Synthetic<4>, Synthetic<5>, Synthetic<6>, Synthetic<7>>(json);
+        return std::move(expected.Value());
+    }
+
+    // the same configuration in both formats, so their sizes and speeds compare
+    std::string Encode(const Synthetic_8& container, bool cbor)
+    {
+        return cbor ? Write_As_CBOR_String(container) : Write_As_JSON_String(container);
+    }
+
+    void CBOR_Shapes(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({ "depth", "array", "string%", "cbor" });
+        for (int cbor : { 0, 1 })
+            b->Args({ 0, 1024, 0, cbor })->Args({ 0, 1024, 100, cbor })->Args({ 4, 256, 50, cbor });
+        b->Unit(benchmark::kMicrosecond);
+    }
+}
+
+static void BM_Build_Format(benchmark::State& state)
+{
+    const bool cbor = state.range(3) != 0;
+    const std::string document = Encode(Make_Synthetic_Container(state), cbor);
+    Parse_Context context;
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = cbor
+                ? Build_From_CBOR_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>, Synthetic<4>, Synthetic<5>, Synthetic<6>, Synthetic<7>>(document, context)
+                : Build_From_JSON_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>, Synthetic<4>, Synthetic<5>, Synthetic<6>, Synthetic<7>>(document, context);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.counters["document_bytes"] = static_cast<double>(document.size());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(document.size()));
+}
+
+static void BM_Write_Format(benchmark::State& state)
+{
+    const bool cbor = state.range(3) != 0;
+    const Synthetic_8 container = Make_Synthetic_Container(state);
+    std::string document;
+    for (auto _ : state)
+    {
+        if (cbor)
+            Write_As_CBOR_String(container, document);
+        else
+            Write_As_JSON_String(container, document);
+        benchmark::DoNotOptimize(document);
+    }
+    state.counters["document_bytes"] = static_cast<double>(document.size());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(document.size()));
+}
+
+BENCHMARK(BM_Build_Format)->Apply(CBOR_Shapes);
+BENCHMARK(BM_Write_Format)->Apply(CBOR_Shapes);
@@ -0,0 +1,94 @@
+// columnar_bench.cpp
+
+#include "allocation_counter.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/module/json_columnar.h"
+
+#include <benchmark/benchmark.h>
+#include <rapidjson/stream.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+struct Rate_Limits
+{
+    std::vector<std::uint64_t> id;
+    std::vector<std::string> route;
+    std::vector<double> rate;
+    std::vector<unsigned> burst;
+};
+
+enum class Rate_Limits_Error
+{
+    SHOULD_BE_AN_ARRAY_OF_OBJECTS,
+    INVALID_ID,
+    INVALID_ROUTE,
+    INVALID_RATE,
+    INVALID_BURST
+};
+
+struct Rate_Limits_Records
+{
+    using Data = Rate_Limits;
+    using Error = Rate_Limits_Error;
+
+    static constexpr const char* Key() noexcept { return "rate_limits"; }
+    static constexpr Rate_Limits_Error Not_An_Array_Error() noexcept { return Rate_Limits_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS; }
+
+    static constexpr auto Columns() noexcept
+    {
+        using namespace O::Configuration::Module;
+        return std::tuple{
+            Column{ "id", &Rate_Limits::id, Rate_Limits_Error::INVALID_ID },
+            Column{ "route", &Rate_Limits::route, Rate_Limits_Error::INVALID_ROUTE },
+            Column{ "rate", &Rate_Limits::rate, Rate_Limits_Error::INVALID_RATE },
+            Optional_Column{ "burst", &Rate_Limits::burst, Rate_Limits_Error::INVALID_BURST }
+        };
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Rate_Limits>
+{
+    using Builder = O::Configuration::Module::JSON_Columnar_Builder<Rate_Limits_Records>;
+};
+
+namespace
+{
+    std::string Make_Rate_Limits_Json(std::size_t count)
+    {
+        std::string json = R"({ "rate_limits": [)";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json += i == 0 ? "" : ",";
+            json += R"({"id":)" + std::to_string(i) + R"(,"route":"/api/v1/resource/)" + std::to_string(i) + R"(","rate":)" + std::to_string(i % 100) + R"(.5,"burst":)" + std::to_string(i % 64) + "}";
+        }
+        return json + "] }";
+    }
+}
+
+// records through the Document, the builder replaying them, or straight from the input stream
+static void BM_Columnar_Build(benchmark::State& state)
+{
+    const bool stream = state.range(1) != 0;
+    const std::string json = Make_Rate_Limits_Json(static_cast<std::size_t>(state.range(0)));
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            rapidjson::StringStream is(json.c_str());
+            auto expected = stream ? Build_From_JSON_Stream<Rate_Limits>(is) : Build_From_JSON_String<Rate_Limits>(json);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+BENCHMARK(BM_Columnar_Build)->ArgNames({ "records", "stream" })->ArgsProduct({ { 1 << 10, 1 << 16 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,49 @@
+// file_read_mode_bench.cpp
+
+#include "bench_structure.h"
+
+#include "configuration/application/json_builder.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    void Build_File(benchmark::State& state, Read_Mode mode)
+    {
+        const std::size_t route_count = static_cast<std::size_t>(state.range(0));
+        const std::filesystem::path path = Write_Route_Table_File(route_count);
+        const auto file_size = static_cast<std::int64_t>(std::filesystem::file_size(path));
+
+        for (auto _ : state)
+        {
+            auto expected = Build_From_JSON_File<Route_Table>(path, mode);
+            if (!expected.Has_Value() || expected.Value().Get<Route_Table>().routes.size() != route_count)
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+
+        state.SetBytesProcessed(state.iterations() * file_size);
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+}
+
+static void BM_Build_File_Stream(benchmark::State& state)
+{
+    Build_File(state, Read_Mode::STREAM);
+}
+
+static void BM_Build_File_Memory_Mapped(benchmark::State& state)
+{
+    Build_File(state, Read_Mode::MEMORY_MAPPED);
+}
+
+BENCHMARK(BM_Build_File_Stream)->RangeMultiplier(16)->Range(1 << 8, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Build_File_Memory_Mapped)->RangeMultiplier(16)->Range(1 << 8, 1 << 18)->Unit(benchmark::kMillisecond);
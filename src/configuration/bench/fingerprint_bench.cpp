@@ -0,0 +1,103 @@
+// fingerprint_bench.cpp
+
+#include "allocation_counter.h"
+#include "synthetic_structure.h"
+
+#include "configuration/application/container_fingerprint.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <utility>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    template<std::size_t MODULE_COUNT, class = std::make_index_sequence<MODULE_COUNT>>
+    struct Fingerprint_Set;
+
+    template<std::size_t MODULE_COUNT, std::size_t... I>
+    struct Fingerprint_Set<MODULE_COUNT, std::index_sequence<I...>>
+    {
+        static auto Build_String(std::string_view json) { return Build_From_JSON_String<Synthetic<I>...>(json); }
+    };
+
+    void Fingerprint_Shapes(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({ "depth", "array", "string%" });
+        b->Args({ 0, 16, 0 })->Args({ 0, 16, 100 })->Args({ 4, 16, 50 });
+        b->Args({ 0, 1024, 0 })->Args({ 0, 1024, 100 });
+        b->Unit(benchmark::kMicrosecond);
+    }
+
+    Synthetic_Shape Shape_Of(const benchmark::State& state)
+    {
+        return Synthetic_Shape{ static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(2)) };
+    }
+}
+
+// equality through the serialized text, the way two nodes compared their configuration before Fingerprint
+template<std::size_t MODULE_COUNT>
+static void BM_Compare_Serialized(benchmark::State& state)
+{
+    auto left = Fingerprint_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    auto right = Fingerprint_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!left.Has_Value() || !right.Has_Value())
+        return state.SkipWithError("build failed");
+
+    std::string left_json;
+    std::string right_json;
+    Allocation_Report report(state);
+    for (auto _ : state)
+    {
+        Write_As_JSON_String(left.Value(), left_json);
+        Write_As_JSON_String(right.Value(), right_json);
+        if (left_json != right_json)
+        {
+            state.SkipWithError("containers differ");
+            break;
+        }
+    }
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Compare_Fingerprint(benchmark::State& state)
+{
+    auto left = Fingerprint_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    auto right = Fingerprint_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!left.Has_Value() || !right.Has_Value())
+        return state.SkipWithError("build failed");
+
+    Allocation_Report report(state);
+    for (auto _ : state)
+    {
+        if (Fingerprint(left.Value()) != Fingerprint(right.Value()))
+        {
+            state.SkipWithError("containers differ");
+            break;
+        }
+    }
+}
+
+// remote node: only the local side is hashed, the other digest came over the wire
+template<std::size_t MODULE_COUNT>
+static void BM_Fingerprint_One_Side(benchmark::State& state)
+{
+    auto expected = Fingerprint_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!expected.Has_Value())
+        return state.SkipWithError("build failed");
+
+    const Digest remote = Fingerprint(expected.Value());
+    Allocation_Report report(state);
+    for (auto _ : state)
+    {
+        const Digest local = Fingerprint(expected.Value());
+        benchmark::DoNotOptimize(local == remote);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Compare_Serialized, 8)->Apply(Fingerprint_Shapes);
+BENCHMARK_TEMPLATE(BM_Compare_Fingerprint, 8)->Apply(Fingerprint_Shapes);
+BENCHMARK_TEMPLATE(BM_Fingerprint_One_Side, 8)->Apply(Fingerprint_Shapes);
@@ -0,0 +1,83 @@
+// include_builder_bench.cpp
+
+#include "bench_structure.h"
+
+#include "configuration/application/batch_builder.h"
+#include "configuration/application/include_builder.h"
+#include "configuration/application/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    constexpr int SERVICE_COUNT = 200;
+
+    // every service uses the same route table, copied in the file or included from a shared fragment
+    std::vector<std::filesystem::path> Write_Services(const std::filesystem::path& directory, const std::filesystem::path& route_table, bool include)
+    {
+        std::filesystem::create_directories(directory);
+        std::string table;
+        if (!include)
+        {
+            std::ifstream ifs(route_table, std::ios::binary);
+            table.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+
+        std::vector<std::filesystem::path> paths;
+        for (int i = 0; i < SERVICE_COUNT; ++i)
+        {
+            paths.push_back(directory / ("service_" + std::to_string(i) + ".json"));
+            std::ofstream ofs(paths.back(), std::ios::binary);
+            if (include)
+                ofs << "{ \"$include\": \"" << route_table.generic_string() << "\" }\n";
+            else
+                ofs << table;
+        }
+        return paths;
+    }
+
+    void Build_Services(benchmark::State& state, bool include)
+    {
+        const std::size_t route_count = static_cast<std::size_t>(state.range(0));
+        const std::filesystem::path route_table = Write_Route_Table_File(route_count);
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / ("bench_include_" + std::to_string(route_count));
+        const std::vector<std::filesystem::path> paths = Write_Services(directory, std::filesystem::absolute(route_table), include);
+
+        Fragment_Cache fragments;
+        for (auto _ : state)
+        {
+            auto results = include ? Build_From_JSON_Files<Route_Table>(paths, Thread_Pool::Shared(), fragments) : Build_From_JSON_Files<Route_Table>(paths, Thread_Pool::Shared());
+            for (const auto& result : results)
+                if (!result.Has_Value() || result.Value().Get<Route_Table>().routes.size() != route_count)
+                {
+                    state.SkipWithError("build failed");
+                    break;
+                }
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * SERVICE_COUNT);
+        std::error_code ec;
+        std::filesystem::remove_all(directory, ec);
+        std::filesystem::remove(route_table, ec);
+    }
+}
+
+static void BM_Build_Services_Copied(benchmark::State& state)
+{
+    Build_Services(state, false);
+}
+
+static void BM_Build_Services_Included(benchmark::State& state)
+{
+    Build_Services(state, true);
+}
+
+BENCHMARK(BM_Build_Services_Copied)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Build_Services_Included)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,78 @@
+// layered_builder_bench.cpp
+
+#include "bench_structure.h"
+
+#include "configuration/application/layered_builder.h"
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    void Write_Override(const std::filesystem::path& path, int metric)
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs << "{ \"host\": { \"metric\": " << metric << " } }\n";
+    }
+
+    // a large route table as the base layer and a small host override
+    void Build_Layers(benchmark::State& state, bool cached, bool edit_override)
+    {
+        const std::size_t route_count = static_cast<std::size_t>(state.range(0));
+        const std::array<std::filesystem::path, 2> layers = {
+            Write_Route_Table_File(route_count),
+            std::filesystem::temp_directory_path() / ("bench_layer_host_" + std::to_string(route_count) + ".json")
+        };
+        Write_Override(layers[1], 1);
+
+        Layer_Cache cache;
+        int metric = 1;
+        for (auto _ : state)
+        {
+            if (edit_override)
+            {
+                // alternate the size so the modification time check sees the edit
+                state.PauseTiming();
+                metric = metric == 1 ? 10 : 1;
+                Write_Override(layers[1], metric);
+                state.ResumeTiming();
+            }
+
+            auto expected = cached ? Build_From_JSON_Layers<Route_Table>(layers, cache) : Build_From_JSON_Layers<Route_Table>(layers);
+            if (!expected.Has_Value() || expected.Value().Get<Route_Table>().routes.size() != route_count)
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+
+        std::error_code ec;
+        for (const std::filesystem::path& path : layers)
+            std::filesystem::remove(path, ec);
+    }
+}
+
+static void BM_Build_Layers_Uncached(benchmark::State& state)
+{
+    Build_Layers(state, false, false);
+}
+
+static void BM_Build_Layers_Cached(benchmark::State& state)
+{
+    Build_Layers(state, true, false);
+}
+
+static void BM_Build_Layers_Cached_Override_Edited(benchmark::State& state)
+{
+    Build_Layers(state, true, true);
+}
+
+BENCHMARK(BM_Build_Layers_Uncached)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Build_Layers_Cached)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Build_Layers_Cached_Override_Edited)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
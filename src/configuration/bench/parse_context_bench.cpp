@@ -0,0 +1,62 @@
+// parse_context_bench.cpp
+
+#include "allocation_counter.h"
+#include "bench_structure.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/parse_context.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    std::string Route_Table_Json(std::size_t route_count)
+    {
+        const std::filesystem::path path = Write_Route_Table_File(route_count);
+        std::ifstream ifs(path, std::ios::binary);
+        std::string json((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        ifs.close();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return json;
+    }
+}
+
+static void BM_Build_String_Fresh_Document(benchmark::State& state)
+{
+    const std::string json = Route_Table_Json(static_cast<std::size_t>(state.range(0)));
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = Build_From_JSON_String<Route_Table>(json);
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+static void BM_Build_String_Parse_Context(benchmark::State& state)
+{
+    const std::string json = Route_Table_Json(static_cast<std::size_t>(state.range(0)));
+    Parse_Context context;
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = Build_From_JSON_String<Route_Table>(json, context);
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+BENCHMARK(BM_Build_String_Fresh_Document)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
+BENCHMARK(BM_Build_String_Parse_Context)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
@@ -0,0 +1,53 @@
+// parse_policy_bench.cpp
+
+#include "allocation_counter.h"
+#include "synthetic_structure.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/parse_context.h"
+#include "configuration/application/parse_policy.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    template<class Policy>
+    void Build_With_Policy(benchmark::State& state)
+    {
+        const std::string json = Make_Synthetic_Json(8, Synthetic_Shape{ static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(2)) });
+        Parse_Context context;
+        {
+            Allocation_Report report(state);
+            for (auto _ : state)
+            {
+                auto expected = Build_From_JSON_String<Synthetic<0>, Synthetic<1>, Synthetic<2>, Synthetic<3>, Synthetic<4>, Synthetic<5>, Synthetic<6>, Synthetic<7>>(json, context, Policy{});
+                if (!expected.Has_Value())
+                {
+                    state.SkipWithError("build failed");
+                    break;
+                }
+                benchmark::DoNotOptimize(expected);
+            }
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+    }
+
+    void Policy_Shapes(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({ "depth", "array", "string%" });
+        b->Args({ 0, 1024, 0 })->Args({ 0, 1024, 100 })->Args({ 4, 256, 50 });
+        b->Unit(benchmark::kMicrosecond);
+    }
+}
+
+static void BM_Build_Default_Parse(benchmark::State& state) { Build_With_Policy<Default_Parse>(state); }
+static void BM_Build_Fast_Parse(benchmark::State& state)    { Build_With_Policy<Fast_Parse>(state); }
+static void BM_Build_Strict_Parse(benchmark::State& state)  { Build_With_Policy<Strict_Parse>(state); }
+
+BENCHMARK(BM_Build_Default_Parse)->Apply(Policy_Shapes);
+BENCHMARK(BM_Build_Fast_Parse)->Apply(Policy_Shapes);
+BENCHMARK(BM_Build_Strict_Parse)->Apply(Policy_Shapes);
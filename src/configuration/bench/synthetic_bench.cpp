@@ -0,0 +1,295 @@
+// synthetic_bench.cpp
+
+#include "allocation_counter.h"
+#include "synthetic_structure.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_validator.h"
+#include "configuration/application/lazy_container.h"
+#include "configuration/application/trace_recorder.h"
+#include "configuration/application/json_writer.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    template<std::size_t MODULE_COUNT, class = std::make_index_sequence<MODULE_COUNT>>
+    struct Synthetic_Set;
+
+    template<std::size_t MODULE_COUNT, std::size_t... I>
+    struct Synthetic_Set<MODULE_COUNT, std::index_sequence<I...>>
+    {
+        static auto Build_String(std::string_view json) { return Build_From_JSON_String<Synthetic<I>...>(json); }
+        static auto Build_File(const std::filesystem::path& path) { return Build_From_JSON_File<Synthetic<I>...>(path); }
+        static auto Build_String(std::string_view json, Parse_Context& context) { return Build_From_JSON_String<Synthetic<I>...>(json, context); }
+        static auto Build_String(std::string_view json, Parse_Context& context, Trace_Recorder& recorder) { return Build_From_JSON_String<Synthetic<I>...>(json, context, recorder); }
+        static auto Build_Lazy_String(std::string_view json) { return Build_Lazy_From_JSON_String<Synthetic<I>...>(json); }
+        static auto Validate_String(std::string_view json, Parse_Context& context) { return Validate_JSON_String<Synthetic<I>...>(json, context); }
+    };
+
+    Synthetic_Shape Shape_Of(const benchmark::State& state)
+    {
+        return Synthetic_Shape{ static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(2)) };
+    }
+
+    std::filesystem::path Write_Synthetic_File(const std::string& json)
+    {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "bench_synthetic.json";
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << json;
+        return path;
+    }
+
+    void Synthetic_Shapes(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({ "depth", "array", "string%" });
+        b->Args({ 0, 16, 0 })->Args({ 0, 16, 100 })->Args({ 4, 16, 50 });
+        b->Args({ 0, 1024, 0 })->Args({ 0, 1024, 100 })->Args({ 4, 256, 50 });
+        b->Unit(benchmark::kMicrosecond);
+    }
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Build_String(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(json);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+// the CI validation loop: one context reused for every file, the build variant is the baseline
+template<std::size_t MODULE_COUNT>
+static void BM_Build_String_Context(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    Parse_Context context;
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(json, context);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+// cost of recording a trace, to compare with BM_Build_String_Context: mostly the serialization measuring each module input, done off the recorded times
+template<std::size_t MODULE_COUNT>
+static void BM_Build_String_Traced(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    Parse_Context context;
+    Trace_Recorder recorder([] { return Allocation_Totals{ Allocation_Counter::count.load(std::memory_order_relaxed), Allocation_Counter::bytes.load(std::memory_order_relaxed) }; });
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            recorder.Clear();
+            auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(json, context, recorder);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Validate_String_Context(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    Parse_Context context;
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            if (Synthetic_Set<MODULE_COUNT>::Validate_String(json, context))
+            {
+                state.SkipWithError("validation failed");
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+// startup of a binary touching a single module out of MODULE_COUNT, to compare with BM_Build_String
+template<std::size_t MODULE_COUNT>
+static void BM_Build_Lazy_Access_One(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto lazy = Synthetic_Set<MODULE_COUNT>::Build_Lazy_String(json);
+            if (!lazy.Has_Value() || !lazy.Value().template Get<Synthetic<0>>().Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(lazy);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Build_File(benchmark::State& state)
+{
+    const std::string json = Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state));
+    const std::filesystem::path path = Write_Synthetic_File(json);
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            auto expected = Synthetic_Set<MODULE_COUNT>::Build_File(path);
+            if (!expected.Has_Value())
+            {
+                state.SkipWithError("build failed");
+                break;
+            }
+            benchmark::DoNotOptimize(expected);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Write_String(benchmark::State& state)
+{
+    auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!expected.Has_Value())
+        return state.SkipWithError("build failed");
+
+    std::size_t size = 0;
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            std::string json = Write_As_JSON_String(expected.Value());
+            size = json.size();
+            benchmark::DoNotOptimize(json);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Write_String_Reused(benchmark::State& state)
+{
+    auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!expected.Has_Value())
+        return state.SkipWithError("build failed");
+
+    std::string json;
+    json.reserve(Measure_JSON_Size(expected.Value()));
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            Write_As_JSON_String(expected.Value(), json);
+            benchmark::DoNotOptimize(json.data());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Write_File(benchmark::State& state)
+{
+    auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!expected.Has_Value())
+        return state.SkipWithError("build failed");
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "bench_synthetic_write.json";
+    {
+        Allocation_Report report(state);
+        for (auto _ : state)
+        {
+            if (Write_As_JSON_File(expected.Value(), path))
+            {
+                state.SkipWithError("write failed");
+                break;
+            }
+        }
+    }
+    std::error_code ec;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(std::filesystem::file_size(path, ec)));
+    std::filesystem::remove(path, ec);
+}
+
+template<std::size_t MODULE_COUNT>
+static void BM_Write_File_Atomic(benchmark::State& state)
+{
+    auto expected = Synthetic_Set<MODULE_COUNT>::Build_String(Make_Synthetic_Json(MODULE_COUNT, Shape_Of(state)));
+    if (!expected.Has_Value())
+        return state.SkipWithError("build failed");
+
+    // temporary file, one fsync and rename per write
+    File_Write_Options options;
+    options.atomic = true;
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "bench_synthetic_write_atomic.json";
+    for (auto _ : state)
+    {
+        if (Write_As_JSON_File(expected.Value(), path, options))
+        {
+            state.SkipWithError("write failed");
+            break;
+        }
+    }
+    std::error_code ec;
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(std::filesystem::file_size(path, ec)));
+    std::filesystem::remove(path, ec);
+}
+
+BENCHMARK_TEMPLATE(BM_Build_String, 1)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_String, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_String, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_String_Context, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_String_Traced, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Validate_String_Context, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_Lazy_Access_One, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_File, 1)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_File, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Build_File, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String, 1)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String_Reused, 1)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String_Reused, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_String_Reused, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_File, 1)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_File, 8)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_File, 32)->Apply(Synthetic_Shapes);
+BENCHMARK_TEMPLATE(BM_Write_File_Atomic, 8)->Apply(Synthetic_Shapes);
@@ -0,0 +1,248 @@
+#ifndef SRC_CONFIGURATION_BENCH_SYNTHETIC_STRUCTURE_H
+#define SRC_CONFIGURATION_BENCH_SYNTHETIC_STRUCTURE_H
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "configuration/module/json_builder.h"
+#include "configuration/module/json_writer.h"
+#include "configuration/module/traits.h"
+
+#include <rapidjson/document.h>
+
+/**
+ * @brief Shape of the generated configurations.
+ */
+struct Synthetic_Shape
+{
+    std::size_t depth = 0;          /**< Number of nested "child" objects below each module object. */
+    std::size_t array_size = 16;    /**< Number of leaves in the "values" array of every object. */
+    std::size_t string_percent = 0; /**< Share of the leaves that are strings, the others are numbers. */
+};
+
+/**
+ * @brief Owned copy of a generated value, so builders copy and writers read as much as a real module would.
+ */
+struct Synthetic_Node
+{
+    enum class Kind { NUMBER, STRING, ARRAY, OBJECT };
+
+    Kind kind = Kind::NUMBER;
+    double number = 0;
+    std::string string;
+    std::vector<std::string> keys;
+    std::vector<Synthetic_Node> children;
+};
+
+/**
+ * @brief Data of the synthetic module I, every instance is a distinct module type with the key "module_<I>".
+ */
+template<std::size_t I>
+struct Synthetic
+{
+    Synthetic_Node root;
+};
+
+enum class Synthetic_Error
+{
+    UNSUPPORTED_VALUE
+};
+
+template<std::size_t I>
+struct Synthetic_Key
+{
+    static constexpr std::array<char, 24> VALUE = []
+        {
+            std::array<char, 24> key{};
+            std::size_t n = 0;
+            for (char c : std::string_view("module_"))
+                key[n++] = c;
+            char digits[20];
+            std::size_t d = 0;
+            std::size_t value = I;
+            do
+            {
+                digits[d++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            while (d != 0)
+                key[n++] = digits[--d];
+            return key;
+        }();
+};
+
+inline bool Load_Synthetic_Node(const rapidjson::Value& v, Synthetic_Node& node)
+{
+    if (v.IsNumber())
+    {
+        node.kind = Synthetic_Node::Kind::NUMBER;
+        node.number = v.GetDouble();
+        return true;
+    }
+    if (v.IsString())
+    {
+        node.kind = Synthetic_Node::Kind::STRING;
+        node.string.assign(v.GetString(), v.GetStringLength());
+        return true;
+    }
+    if (v.IsArray())
+    {
+        node.kind = Synthetic_Node::Kind::ARRAY;
+        node.children.resize(v.Size());
+        for (rapidjson::SizeType i = 0; i < v.Size(); ++i)
+            if (!Load_Synthetic_Node(v[i], node.children[i]))
+                return false;
+        return true;
+    }
+    if (v.IsObject())
+    {
+        node.kind = Synthetic_Node::Kind::OBJECT;
+        node.keys.reserve(v.MemberCount());
+        node.children.resize(v.MemberCount());
+        std::size_t i = 0;
+        for (auto member = v.MemberBegin(); member != v.MemberEnd(); ++member, ++i)
+        {
+            node.keys.emplace_back(member->name.GetString(), member->name.GetStringLength());
+            if (!Load_Synthetic_Node(member->value, node.children[i]))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+inline bool Validate_Synthetic_Node(const rapidjson::Value& v)
+{
+    if (v.IsNumber() || v.IsString())
+        return true;
+    if (v.IsArray())
+    {
+        for (const rapidjson::Value& child : v.GetArray())
+            if (!Validate_Synthetic_Node(child))
+                return false;
+        return true;
+    }
+    if (v.IsObject())
+    {
+        for (auto member = v.MemberBegin(); member != v.MemberEnd(); ++member)
+            if (!Validate_Synthetic_Node(member->value))
+                return false;
+        return true;
+    }
+    return false;
+}
+
+template<class W>
+void Write_Synthetic_Node(W& w, const Synthetic_Node& node)
+{
+    switch (node.kind)
+    {
+    case Synthetic_Node::Kind::NUMBER:
+        w.Double(node.number);
+        break;
+    case Synthetic_Node::Kind::STRING:
+        w.String(node.string.data(), static_cast<rapidjson::SizeType>(node.string.size()));
+        break;
+    case Synthetic_Node::Kind::ARRAY:
+        w.StartArray();
+        for (const Synthetic_Node& child : node.children)
+            Write_Synthetic_Node(w, child);
+        w.EndArray();
+        break;
+    case Synthetic_Node::Kind::OBJECT:
+        w.StartObject();
+        for (std::size_t i = 0; i < node.children.size(); ++i)
+        {
+            w.Key(node.keys[i].data(), static_cast<rapidjson::SizeType>(node.keys[i].size()));
+            Write_Synthetic_Node(w, node.children[i]);
+        }
+        w.EndObject();
+        break;
+    }
+}
+
+template<std::size_t I>
+struct Synthetic_Builder : O::Configuration::Module::JSON_Builder<Synthetic_Builder<I>, Synthetic<I>, Synthetic_Error>
+{
+    static constexpr const char* Key() noexcept { return Synthetic_Key<I>::VALUE.data(); }
+
+    std::optional<Synthetic_Error> Load_From_JSON(const rapidjson::Value& v)
+    {
+        if (!Load_Synthetic_Node(v, this->data.root))
+            return Synthetic_Error::UNSUPPORTED_VALUE;
+        return std::nullopt;
+    }
+
+    std::optional<Synthetic_Error> Validate_JSON(const rapidjson::Value& v)
+    {
+        if (!Validate_Synthetic_Node(v))
+            return Synthetic_Error::UNSUPPORTED_VALUE;
+        return std::nullopt;
+    }
+};
+
+template<std::size_t I>
+struct Synthetic_Writer : O::Configuration::Module::JSON_Writer<Synthetic_Writer<I>, Synthetic<I>>
+{
+    static constexpr const char* Key() noexcept { return Synthetic_Key<I>::VALUE.data(); }
+
+    template<class W>
+    void To_JSON(W& w, const Synthetic<I>& data) const
+    {
+        Write_Synthetic_Node(w, data.root);
+    }
+};
+
+template<std::size_t I>
+struct O::Configuration::Module::Traits<Synthetic<I>>
+{
+    using Builder = Synthetic_Builder<I>;
+    using Writer = Synthetic_Writer<I>;
+};
+
+/**
+ * @brief Generate the JSON of one synthetic module object.
+ */
+inline void Append_Synthetic_Object(std::string& json, const Synthetic_Shape& shape, std::size_t depth)
+{
+    json += "{ \"values\": [";
+    for (std::size_t i = 0; i < shape.array_size; ++i)
+    {
+        if (i != 0)
+            json += ", ";
+        if (i * 100 < shape.string_percent * shape.array_size)
+            json += "\"value_" + std::to_string(i) + "_abcdefghijklmnop\"";
+        else
+            json += std::to_string(i) + ".25";
+    }
+    json += "]";
+    if (depth != 0)
+    {
+        json += ", \"child\": ";
+        Append_Synthetic_Object(json, shape, depth - 1);
+    }
+    json += " }";
+}
+
+/**
+ * @brief Generate a configuration holding module_count synthetic modules of the given shape.
+ */
+inline std::string Make_Synthetic_Json(std::size_t module_count, const Synthetic_Shape& shape)
+{
+    std::string json = "{\n";
+    for (std::size_t i = 0; i < module_count; ++i)
+    {
+        json += "  \"module_" + std::to_string(i) + "\": ";
+        Append_Synthetic_Object(json, shape, shape.depth);
+        json += i + 1 == module_count ? "\n" : ",\n";
+    }
+    json += "}\n";
+    return json;
+}
+
+#endif //SRC_CONFIGURATION_BENCH_SYNTHETIC_STRUCTURE_H
@@ -0,0 +1,241 @@
+// arena_container_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/arena_container.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/module/json_fields.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    // allocator aware module, every string it holds uses the resource it was constructed with
+    struct Names
+    {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        Names() = default;
+        explicit Names(const allocator_type& allocator) : list(allocator) {}
+        Names(const Names& other, const allocator_type& allocator) : list(other.list, allocator) {}
+        Names(Names&& other, const allocator_type& allocator) : list(std::move(other.list), allocator) {}
+        Names(const Names&) = default;
+        Names(Names&&) = default;
+        Names& operator=(const Names&) = default;
+        Names& operator=(Names&&) = default;
+
+        std::pmr::vector<std::pmr::string> list;
+    };
+
+    enum class Names_Error
+    {
+        SHOULD_BE_AN_ARRAY_OF_STRINGS
+    };
+
+    struct Names_Builder : O::Configuration::Module::JSON_Builder<Names_Builder, Names, Names_Error>
+    {
+        using JSON_Builder::JSON_Builder;
+
+        std::optional<Names_Error> Load_From_JSON(const rapidjson::Value& v)
+        {
+            if (!v.IsArray())
+                return Names_Error::SHOULD_BE_AN_ARRAY_OF_STRINGS;
+            for (const rapidjson::Value& name : v.GetArray())
+            {
+                if (!name.IsString())
+                    return Names_Error::SHOULD_BE_AN_ARRAY_OF_STRINGS;
+                data.list.emplace_back(name.GetString(), name.GetStringLength());
+            }
+            return std::nullopt;
+        }
+
+        static constexpr const char* Key() noexcept { return "names"; }
+    };
+
+    struct Host
+    {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        Host() = default;
+        explicit Host(const allocator_type& allocator) : name(allocator) {}
+        Host(const Host& other, const allocator_type& allocator) : name(other.name, allocator), port(other.port) {}
+        Host(Host&& other, const allocator_type& allocator) : name(std::move(other.name), allocator), port(other.port) {}
+        Host(const Host&) = default;
+        Host(Host&&) = default;
+        Host& operator=(const Host&) = default;
+        Host& operator=(Host&&) = default;
+
+        std::pmr::string name;
+        int port = 0;
+    };
+
+    enum class Host_Error
+    {
+        SHOULD_BE_AN_OBJECT,
+        NAME_SHOULD_BE_A_STRING,
+        PORT_SHOULD_BE_AN_INT
+    };
+
+    struct Host_Fields
+    {
+        using Data = Host;
+        using Error = Host_Error;
+
+        static constexpr const char* Key() noexcept { return "host"; }
+        static constexpr Host_Error Not_An_Object_Error() noexcept { return Host_Error::SHOULD_BE_AN_OBJECT; }
+
+        static constexpr auto Fields() noexcept
+        {
+            using namespace O::Configuration::Module;
+            return std::tuple{
+                Field{ "name", &Host::name, Host_Error::NAME_SHOULD_BE_A_STRING },
+                Field{ "port", &Host::port, Host_Error::PORT_SHOULD_BE_AN_INT }
+            };
+        }
+    };
+
+    // counts what goes through it, to check where the modules allocate
+    class Counting_Resource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    const std::string input = R"json({
+        "names": [ "a rather long name that does not fit in the small string buffer", "another rather long name, also allocated from the resource" ],
+        "numeric": { "tolerance": 0.25 },
+        "host": { "name": "a host name long enough to need an allocation", "port": 8080 }
+    })json";
+}
+
+template<>
+struct O::Configuration::Module::Traits<Names>
+{
+    using Builder = Names_Builder;
+};
+
+template<>
+struct O::Configuration::Module::Traits<Host>
+{
+    using Builder = O::Configuration::Module::JSON_Fields_Builder<Host_Fields>;
+};
+
+TEST(Arena_Container, modules_allocate_from_the_resource)
+{
+    Counting_Resource resource;
+    {
+        auto result = Build_From_JSON_String<Names, Numeric, Host>(input, &resource);
+        ASSERT_TRUE(result.Has_Value());
+
+        const Names& names = result.Value().Get<Names>();
+        ASSERT_EQ(names.list.size(), 2u);
+        ASSERT_EQ(names.list[1], "another rather long name, also allocated from the resource");
+        ASSERT_EQ(names.list.get_allocator().resource(), &resource);
+        ASSERT_EQ(names.list[0].get_allocator().resource(), &resource);
+
+        const Host& host = result.Value().Get<Host>();
+        ASSERT_EQ(host.name, "a host name long enough to need an allocation");
+        ASSERT_EQ(host.port, 8080);
+        ASSERT_EQ(host.name.get_allocator().resource(), &resource);
+
+        // modules without allocator are built as usual
+        ASSERT_EQ(result.Value().Get<Numeric>().tolerance, 0.25);
+        ASSERT_GE(resource.allocations, 4u);
+    }
+}
+
+TEST(Arena_Container, missing_modules_use_the_resource)
+{
+    Counting_Resource resource;
+    auto result = Build_From_JSON_String<Names, Host>("{}", &resource);
+    ASSERT_TRUE(result.Has_Value());
+    ASSERT_TRUE(result.Value().Get<Names>().list.empty());
+    ASSERT_EQ(result.Value().Get<Names>().list.get_allocator().resource(), &resource);
+    ASSERT_EQ(result.Value().Get<Host>().name.get_allocator().resource(), &resource);
+}
+
+TEST(Arena_Container, errors)
+{
+    Counting_Resource resource;
+
+    auto bad_names = Build_From_JSON_String<Names, Numeric>(R"json({ "names": [ 1 ], "numeric": { "tolerance": -1 } })json", &resource);
+    ASSERT_FALSE(bad_names.Has_Value());
+    ASSERT_EQ(bad_names.Error().module_name, "names");
+    ASSERT_EQ(bad_names.Error().error_id, static_cast<int>(Names_Error::SHOULD_BE_AN_ARRAY_OF_STRINGS));
+
+    auto bad_numeric = Build_From_JSON_String<Numeric, Names>(R"json({ "names": [ 1 ], "numeric": { "tolerance": -1 } })json", &resource);
+    ASSERT_FALSE(bad_numeric.Has_Value());
+    ASSERT_EQ(bad_numeric.Error().module_name, "numeric");
+
+    auto not_an_object = Build_Arena_From_JSON_String<Names>("[]");
+    ASSERT_FALSE(not_an_object.Has_Value());
+    ASSERT_EQ(not_an_object.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    auto missing = Build_Arena_From_JSON_File<Names>("tmp_arena_missing.json");
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
+
+TEST(Arena_Container, owns_its_arena)
+{
+    auto result = Build_Arena_From_JSON_String<Names, Numeric, Host>(input);
+    ASSERT_TRUE(result.Has_Value());
+
+    Arena_Container<Names, Numeric, Host> config = std::move(result.Value());
+    const Names* names = &config.Get<Names>();
+    ASSERT_EQ(names->list.get_allocator().resource(), config.Resource());
+    ASSERT_EQ(config->Get<Host>().name.get_allocator().resource(), config.Resource());
+
+    // moving the container keeps the modules in place
+    Arena_Container<Names, Numeric, Host> moved = std::move(config);
+    ASSERT_EQ(&moved.Get<Names>(), names);
+    ASSERT_EQ((*moved).Get<Numeric>().tolerance, 0.25);
+}
+
+TEST(Arena_Container, file)
+{
+    const std::filesystem::path path = "tmp_arena_container.json";
+    std::ofstream(path, std::ios::binary) << input;
+
+    for (Read_Mode mode : { Read_Mode::STREAM, Read_Mode::MEMORY_MAPPED })
+    {
+        auto result = Build_Arena_From_JSON_File<Names, Host>(path, mode);
+        ASSERT_TRUE(result.Has_Value());
+        ASSERT_EQ(result.Value().Get<Names>().list.size(), 2u);
+        ASSERT_EQ(result.Value().Get<Host>().name.get_allocator().resource(), result.Value().Resource());
+
+        Counting_Resource resource;
+        auto with_resource = Build_From_JSON_File<Names, Host>(path, &resource, mode);
+        ASSERT_TRUE(with_resource.Has_Value());
+        ASSERT_EQ(with_resource.Value().Get<Host>().port, 8080);
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
@@ -0,0 +1,106 @@
+// batch_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/batch_builder.h"
+#include "configuration/application/thread_pool.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    std::string Numeric_Json(int i)
+    {
+        // every seventh input is invalid
+        const int tolerance = i % 7 == 3 ? -i : i;
+        return "{ \"numeric\": { \"tolerance\": " + std::to_string(tolerance) + " }, \"range\": { \"min\": 0, \"max\": " + std::to_string(i) + " } }";
+    }
+
+    template<class Results>
+    void Check_Results(const Results& results, int count)
+    {
+        ASSERT_EQ(results.size(), static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            if (i % 7 == 3)
+            {
+                ASSERT_FALSE(results[i].Has_Value()) << i;
+                ASSERT_EQ(results[i].Error().error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+                continue;
+            }
+            ASSERT_TRUE(results[i].Has_Value()) << i;
+            ASSERT_DOUBLE_EQ(results[i].Value().template Get<Numeric>().tolerance, i);
+            ASSERT_EQ(results[i].Value().template Get<Range>().max, i);
+        }
+    }
+}
+
+TEST(Batch_Builder, files_in_input_order)
+{
+    constexpr int COUNT = 40;
+    std::vector<std::filesystem::path> paths;
+    for (int i = 0; i < COUNT; ++i)
+    {
+        paths.emplace_back("tmp_batch_" + std::to_string(i) + ".json");
+        std::ofstream(paths.back(), std::ios::binary) << Numeric_Json(i);
+    }
+
+    for (std::size_t threads : { 0u, 3u })
+    {
+        Thread_Pool pool(threads);
+        Check_Results(Build_From_JSON_Files<Numeric, Range>(paths, pool), COUNT);
+        Check_Results(Build_From_JSON_Files<Numeric, Range>(paths, pool, Read_Mode::MEMORY_MAPPED), COUNT);
+    }
+
+    std::error_code ec;
+    for (const std::filesystem::path& path : paths)
+        std::filesystem::remove(path, ec);
+
+    Thread_Pool pool(2);
+    auto missing = Build_From_JSON_Files<Numeric, Range>(paths, pool);
+    ASSERT_EQ(missing.size(), paths.size());
+    for (const auto& result : missing)
+    {
+        ASSERT_FALSE(result.Has_Value());
+        ASSERT_EQ(result.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+    }
+    ASSERT_TRUE((Build_From_JSON_Files<Numeric, Range>({}, pool).empty()));
+}
+
+TEST(Batch_Builder, ndjson)
+{
+    constexpr int COUNT = 50;
+    std::string ndjson = "\n";
+    for (int i = 0; i < COUNT; ++i)
+        ndjson += Numeric_Json(i) + (i % 2 ? "\r\n" : "\n  \n");
+
+    Thread_Pool pool(3);
+    Check_Results(Build_From_NDJSON_String<Numeric, Range>(ndjson, pool), COUNT);
+
+    const std::filesystem::path path = "tmp_batch.ndjson";
+    std::ofstream(path, std::ios::binary) << ndjson << "{ \"numeric\": ";
+
+    auto from_file = Build_From_NDJSON_File<Numeric, Range>(path, pool);
+    ASSERT_TRUE(from_file.Has_Value());
+    auto& results = from_file.Value();
+    ASSERT_EQ(results.size(), static_cast<std::size_t>(COUNT + 1));
+    ASSERT_FALSE(results.back().Has_Value());
+    ASSERT_EQ(results.back().Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+    results.pop_back();
+    Check_Results(results, COUNT);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    auto missing = Build_From_NDJSON_File<Numeric, Range>(path, pool);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
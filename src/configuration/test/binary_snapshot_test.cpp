@@ -0,0 +1,137 @@
+// binary_snapshot_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/binary_snapshot.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    constexpr auto JSON = R"json({
+        "numeric": { "tolerance": 0.25 },
+        "various_data": { "type": "double", "value": 1.5 },
+        "range": { "min": -3, "max": 9 }
+    })json";
+
+    void Write_Text(const std::filesystem::path& p, const std::string& content)
+    {
+        std::ofstream ofs(p, std::ios::binary);
+        ofs << content;
+    }
+
+    std::string Read_Text(const std::filesystem::path& p)
+    {
+        std::ifstream ifs(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(ifs), {});
+    }
+
+    Container<Numeric, Various_Data, Range> Build()
+    {
+        auto expected = Build_From_JSON_String<Numeric, Various_Data, Range>(JSON);
+        EXPECT_TRUE(expected.Has_Value());
+        return std::move(expected).Value();
+    }
+}
+
+TEST(Binary_Snapshot, roundtrip)
+{
+    const std::filesystem::path p = "temp_snapshot.bin";
+    const std::uint64_t source_hash = Snapshot_Source_Hash(JSON);
+
+    ASSERT_FALSE(Write_Binary_Snapshot(Build(), p, source_hash).has_value());
+
+    auto loaded = Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_DOUBLE_EQ(loaded->Get<Numeric>().tolerance, 0.25);
+    ASSERT_DOUBLE_EQ(std::get<Double>(loaded->Get<Various_Data>().type).value, 1.5);
+    ASSERT_EQ(loaded->Get<Range>().min, -3);
+    ASSERT_EQ(loaded->Get<Range>().max, 9);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Binary_Snapshot, rejected_when_not_trusted)
+{
+    const std::filesystem::path p = "temp_snapshot_rejected.bin";
+    const std::uint64_t source_hash = Snapshot_Source_Hash(JSON);
+    ASSERT_FALSE(Write_Binary_Snapshot(Build(), p, source_hash).has_value());
+    const std::string bytes = Read_Text(p);
+
+    // other source, other module list
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash + 1).has_value()));
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Range, Various_Data>(p, source_hash).has_value()));
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data>(p, source_hash).has_value()));
+
+    // truncated, corrupted payload, missing
+    Write_Text(p, bytes.substr(0, bytes.size() - 1));
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash).has_value()));
+    Write_Text(p, bytes.substr(0, 10));
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash).has_value()));
+    std::string corrupted = bytes;
+    corrupted.back() ^= 0x40;
+    Write_Text(p, corrupted);
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash).has_value()));
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+    ASSERT_FALSE((Read_Binary_Snapshot<Numeric, Various_Data, Range>(p, source_hash).has_value()));
+}
+
+TEST(Binary_Snapshot, cached_build_follows_the_source)
+{
+    const std::filesystem::path json_path = "temp_snapshot_source.json";
+    const std::filesystem::path snapshot_path = "temp_snapshot_source.bin";
+    std::error_code ec;
+    std::filesystem::remove(snapshot_path, ec);
+    Write_Text(json_path, JSON);
+
+    // first build writes the snapshot
+    auto first = Build_From_JSON_File_Cached<Numeric, Various_Data, Range>(json_path, snapshot_path);
+    ASSERT_TRUE(first.Has_Value());
+    ASSERT_TRUE(std::filesystem::exists(snapshot_path));
+    ASSERT_EQ(first.Value().Get<Range>().max, 9);
+
+    // the snapshot is used while the source is unchanged
+    auto second = Build_From_JSON_File_Cached<Numeric, Various_Data, Range>(json_path, snapshot_path);
+    ASSERT_TRUE(second.Has_Value());
+    ASSERT_DOUBLE_EQ(second.Value().Get<Numeric>().tolerance, 0.25);
+    ASSERT_EQ(second.Value().Get<Range>().min, -3);
+
+    // a snapshot for the same source is trusted over the JSON
+    Container<Numeric, Various_Data, Range> forged = Build();
+    forged.Get<Range>().max = 42;
+    ASSERT_FALSE(Write_Binary_Snapshot(forged, snapshot_path, Snapshot_Source_Hash(JSON)).has_value());
+    auto from_snapshot = Build_From_JSON_File_Cached<Numeric, Various_Data, Range>(json_path, snapshot_path);
+    ASSERT_TRUE(from_snapshot.Has_Value());
+    ASSERT_EQ(from_snapshot.Value().Get<Range>().max, 42);
+
+    // an edited source makes the snapshot stale
+    Write_Text(json_path, R"json({ "numeric": { "tolerance": 0.5 }, "range": { "min": 1, "max": 2 } })json");
+    auto edited = Build_From_JSON_File_Cached<Numeric, Various_Data, Range>(json_path, snapshot_path);
+    ASSERT_TRUE(edited.Has_Value());
+    ASSERT_DOUBLE_EQ(edited.Value().Get<Numeric>().tolerance, 0.5);
+    ASSERT_EQ(edited.Value().Get<Range>().max, 2);
+    ASSERT_EQ(std::get<Int>(edited.Value().Get<Various_Data>().type).value, 0);
+
+    // errors are reported and do not replace the snapshot
+    Write_Text(json_path, R"json({ "range": { "min": 3, "max": 2 } })json");
+    auto invalid = Build_From_JSON_File_Cached<Numeric, Various_Data, Range>(json_path, snapshot_path);
+    ASSERT_FALSE(invalid.Has_Value());
+    ASSERT_EQ(invalid.Error().module_name, std::string_view("range"));
+
+    auto missing = Build_From_JSON_File_Cached<Numeric>("this_file_should_not_exist_12345.json", snapshot_path);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+
+    std::filesystem::remove(json_path, ec);
+    std::filesystem::remove(snapshot_path, ec);
+}
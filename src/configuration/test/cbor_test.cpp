@@ -0,0 +1,175 @@
+// cbor_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+#include "test_structure_Writer.h"
+
+#include "configuration/application/cbor.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+#include "configuration/application/parse_context.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    std::string Bytes(std::initializer_list<int> bytes)
+    {
+        std::string out;
+        for (int byte : bytes)
+            out.push_back(static_cast<char>(byte));
+        return out;
+    }
+
+    // CBOR text string head followed by its characters, for strings shorter than 24 bytes
+    std::string Text(const std::string& text)
+    {
+        return Bytes({ 0x60 + static_cast<int>(text.size()) }) + text;
+    }
+
+    Container<Numeric, Various_Data, Range> Sample()
+    {
+        Container<Numeric, Various_Data, Range> container;
+        std::get<Numeric>(container.modules).tolerance = 0.1;
+        std::get<Various_Data>(container.modules).type = Double{ -2.5 };
+        std::get<Range>(container.modules) = Range{ -70000, 300 };
+        return container;
+    }
+}
+
+TEST(CBOR, round_trip)
+{
+    const auto container = Sample();
+    const std::string cbor = Write_As_CBOR_String(container);
+    const std::string json = Write_As_JSON_String(container);
+    ASSERT_LT(cbor.size(), json.size());
+
+    auto built = Build_From_CBOR_String<Numeric, Various_Data, Range>(cbor);
+    ASSERT_TRUE(built.Has_Value());
+    ASSERT_EQ(std::get<Numeric>(built.Value().modules).tolerance, 0.1);
+    ASSERT_EQ(std::get<Double>(std::get<Various_Data>(built.Value().modules).type).value, -2.5);
+    ASSERT_EQ(std::get<Range>(built.Value().modules).min, -70000);
+    ASSERT_EQ(std::get<Range>(built.Value().modules).max, 300);
+
+    // same JSON once written back
+    ASSERT_EQ(Write_As_JSON_String(built.Value()), json);
+
+    std::string reused = "previous content";
+    Write_As_CBOR_String(container, reused);
+    ASSERT_EQ(reused, cbor);
+}
+
+TEST(CBOR, encoding)
+{
+    Container<Range> container;
+    std::get<Range>(container.modules) = Range{ 1, 500 };
+
+    // { "range": { "min": 1, "max": 500 } } with an indefinite length module map
+    const std::string expected = Bytes({ 0xA1 }) + Text("range") + Bytes({ 0xBF }) + Text("min") + Bytes({ 0x01 }) + Text("max") + Bytes({ 0x19, 0x01, 0xF4, 0xFF });
+    ASSERT_EQ(Write_As_CBOR_String(container), expected);
+}
+
+TEST(CBOR, reader_accepts_other_encoders)
+{
+    // definite lengths, a tagged half float, an indefinite length key and a 8 byte integer head
+    const std::string cbor = Bytes({ 0xA2 })
+        + Text("numeric") + Bytes({ 0xA1 }) + Bytes({ 0x7F }) + Text("toler") + Text("ance") + Bytes({ 0xFF }) + Bytes({ 0xC1, 0xF9, 0x3E, 0x00 })
+        + Text("range") + Bytes({ 0xA2 }) + Text("min") + Bytes({ 0x3B, 0, 0, 0, 0, 0, 0, 0, 0x04 }) + Text("max") + Bytes({ 0x18, 0x20 });
+
+    auto built = Build_From_CBOR_String<Numeric, Range>(cbor);
+    ASSERT_TRUE(built.Has_Value());
+    ASSERT_EQ(std::get<Numeric>(built.Value().modules).tolerance, 1.5);
+    ASSERT_EQ(std::get<Range>(built.Value().modules).min, -5);
+    ASSERT_EQ(std::get<Range>(built.Value().modules).max, 32);
+}
+
+TEST(CBOR, doubles_out_of_the_float_range)
+{
+    for (double value : { 1e300, -1e300, std::numeric_limits<double>::max(), std::numeric_limits<double>::infinity() })
+    {
+        Container<Various_Data> container;
+        std::get<Various_Data>(container.modules).type = Double{ value };
+        const std::string cbor = Write_As_CBOR_String(container);
+
+        auto built = Build_From_CBOR_String<Various_Data>(cbor);
+        ASSERT_TRUE(built.Has_Value());
+        ASSERT_EQ(std::get<Double>(std::get<Various_Data>(built.Value().modules).type).value, value);
+    }
+}
+
+TEST(CBOR, transcodes_to_json)
+{
+    const auto container = Sample();
+    const std::string cbor = Write_As_CBOR_String(container);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    CBOR_Reader reader(cbor);
+    ASSERT_TRUE(reader.Parse(writer));
+    ASSERT_EQ(std::string(buffer.GetString()), Write_As_JSON_String(container));
+}
+
+TEST(CBOR, errors)
+{
+    const std::string valid = Write_As_CBOR_String(Sample());
+    auto parse_error = [](const std::string& cbor)
+        {
+            auto result = Build_From_CBOR_String<Numeric, Various_Data, Range>(cbor);
+            return !result.Has_Value() && result.Error().error_id == static_cast<int>(CBOR_PARSING_FAILED);
+        };
+
+    ASSERT_TRUE(parse_error(""));
+    ASSERT_TRUE(parse_error(valid.substr(0, valid.size() - 1)));
+    ASSERT_TRUE(parse_error(valid + Bytes({ 0xF6 })));
+    ASSERT_TRUE(parse_error(Bytes({ 0xA1, 0x41, 'a', 0xF6 })));         // byte string key
+    ASSERT_TRUE(parse_error(Bytes({ 0xA1, 0x01, 0xF6 })));              // integer key
+    ASSERT_TRUE(parse_error(Bytes({ 0xA1 }) + Text("range") + Bytes({ 0x42, 1, 2 }))); // byte string value
+    ASSERT_TRUE(parse_error(Bytes({ 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF })));
+    ASSERT_TRUE(parse_error(Bytes({ 0x3B, 0x80, 0, 0, 0, 0, 0, 0, 0 }))); // below INT64_MIN
+    ASSERT_TRUE(parse_error(std::string(CBOR_Reader::MAX_DEPTH + 2, static_cast<char>(0x81)) + Bytes({ 0xF6 })));
+
+    auto not_an_object = Build_From_CBOR_String<Numeric>(Bytes({ 0x82, 0x01, 0x02 }));
+    ASSERT_FALSE(not_an_object.Has_Value());
+    ASSERT_EQ(not_an_object.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    auto module_error = Build_From_CBOR_String<Numeric>(Bytes({ 0xA1 }) + Text("numeric") + Bytes({ 0xA1 }) + Text("tolerance") + Bytes({ 0x20 }));
+    ASSERT_FALSE(module_error.Has_Value());
+    ASSERT_EQ(module_error.Error().module_name, "numeric");
+}
+
+TEST(CBOR, file)
+{
+    const std::filesystem::path path = "tmp_cbor.cbor";
+    const auto container = Sample();
+    ASSERT_FALSE(Write_As_CBOR_File(container, path).has_value());
+
+    File_Write_Options options;
+    options.atomic = true;
+    options.buffer_size = 7;
+    ASSERT_FALSE(Write_As_CBOR_File(container, path, options).has_value());
+
+    Parse_Context context;
+    auto with_context = Build_From_CBOR_File<Numeric, Various_Data, Range>(path, context);
+    auto without = Build_From_CBOR_File<Numeric, Various_Data, Range>(path);
+    ASSERT_TRUE(with_context.Has_Value());
+    ASSERT_TRUE(without.Has_Value());
+    ASSERT_EQ(Write_As_CBOR_String(with_context.Value()), Write_As_CBOR_String(container));
+    ASSERT_EQ(Write_As_CBOR_String(without.Value()), Write_As_CBOR_String(container));
+
+    auto missing = Build_From_CBOR_File<Numeric>("tmp_cbor_missing.cbor");
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
@@ -0,0 +1,215 @@
+// constant_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/constant_builder.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/module/constant_value.h"
+#include "configuration/module/json_fields.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+using namespace O::Configuration::Application;
+using O::Configuration::Module::Constant_Document;
+using O::Configuration::Module::Constant_Value;
+
+struct Service
+{
+    std::string_view name;
+    int port = 0;
+    bool secure = false;
+    double weight = 1;
+    std::int64_t offset = 0;
+    std::uint64_t id = 0;
+};
+
+enum class Service_Error
+{
+    SHOULD_BE_AN_OBJECT,
+    NAME_SHOULD_BE_A_STRING,
+    PORT_SHOULD_BE_AN_INT,
+    PORT_OUT_OF_RANGE,
+    SECURE_SHOULD_BE_A_BOOL,
+    WEIGHT_SHOULD_BE_A_NUMBER,
+    OFFSET_SHOULD_BE_AN_INT64,
+    ID_SHOULD_BE_AN_UNSIGNED
+};
+
+struct Service_Fields
+{
+    using Data = Service;
+    using Error = Service_Error;
+
+    static constexpr const char* Key() noexcept { return "service"; }
+    static constexpr Service_Error Not_An_Object_Error() noexcept { return Service_Error::SHOULD_BE_AN_OBJECT; }
+
+    static constexpr auto Fields() noexcept
+    {
+        using namespace O::Configuration::Module;
+        return std::tuple{
+            Field{ "name", &Service::name, Service_Error::NAME_SHOULD_BE_A_STRING },
+            Field{ "port", &Service::port, Service_Error::PORT_SHOULD_BE_AN_INT,
+                [](int port) { return port > 0 && port < 65536 ? std::nullopt : std::optional(Service_Error::PORT_OUT_OF_RANGE); } },
+            Optional_Field{ "secure", &Service::secure, Service_Error::SECURE_SHOULD_BE_A_BOOL },
+            Optional_Field{ "weight", &Service::weight, Service_Error::WEIGHT_SHOULD_BE_A_NUMBER },
+            Optional_Field{ "offset", &Service::offset, Service_Error::OFFSET_SHOULD_BE_AN_INT64 },
+            Optional_Field{ "id", &Service::id, Service_Error::ID_SHOULD_BE_AN_UNSIGNED }
+        };
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Service>
+{
+    using Builder = O::Configuration::Module::JSON_Fields_Builder<Service_Fields>;
+};
+
+// hand written builder, only the compile time hook is needed
+struct Levels
+{
+    std::array<int, 4> values{};
+    std::size_t count = 0;
+};
+
+enum class Levels_Error
+{
+    SHOULD_BE_AN_ARRAY,
+    TOO_MANY_LEVELS,
+    LEVEL_SHOULD_BE_AN_INT
+};
+
+struct Levels_Builder
+{
+    static constexpr const char* Key() noexcept { return "levels"; }
+
+    static constexpr std::optional<Levels_Error> Load_Constant(const Constant_Value& v, Levels& data)
+    {
+        if (!v.Is_Array())
+            return Levels_Error::SHOULD_BE_AN_ARRAY;
+        if (v.Size() > data.values.size())
+            return Levels_Error::TOO_MANY_LEVELS;
+        for (std::size_t i = 0; i < v.Size(); ++i)
+        {
+            if (!v[i].Is_Int())
+                return Levels_Error::LEVEL_SHOULD_BE_AN_INT;
+            data.values[i] = v[i].Get_Int();
+        }
+        data.count = v.Size();
+        return std::nullopt;
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Levels>
+{
+    using Builder = Levels_Builder;
+};
+
+namespace
+{
+    constexpr char DEFAULTS_JSON[] = R"json(
+    {
+        "numeric": { "tolerance": 0.1 },
+        "service": { "name": "café \"main\"\n", "port": 8080, "weight": 2.5e-3, "offset": -9007199254740993, "id": 18446744073709551615, "unknown": [1, {}] },
+        "levels": [ 3, -1, 4 ],
+        "service": { "name": "ignored", "port": 1 }
+    })json";
+
+    constexpr auto DEFAULTS = Build_From_JSON_Constant<R"json(
+    {
+        "numeric": { "tolerance": 0.1 },
+        "service": { "name": "café \"main\"\n", "port": 8080, "weight": 2.5e-3, "offset": -9007199254740993, "id": 18446744073709551615, "unknown": [1, {}] },
+        "levels": [ 3, -1, 4 ],
+        "service": { "name": "ignored", "port": 1 }
+    })json", Fields_Numeric, Service, Levels>();
+
+    static_assert(DEFAULTS.Get<Service>().port == 8080);
+    static_assert(DEFAULTS.Get<Service>().name == "caf\xC3\xA9 \"main\"\n");
+    static_assert(DEFAULTS.Get<Service>().offset == -9007199254740993);
+    static_assert(DEFAULTS.Get<Service>().id == std::numeric_limits<std::uint64_t>::max());
+    static_assert(!DEFAULTS.Get<Service>().secure);
+    static_assert(DEFAULTS.Get<Levels>().count == 3 && DEFAULTS.Get<Levels>().values[2] == 4);
+
+    template<Fixed_String JSON, class... Data_Modules>
+    constexpr bool Fails_With(std::string_view module_name, int error_id)
+    {
+        const std::optional<Error> error = Validate_JSON_Constant<JSON, Data_Modules...>();
+        return error && error->module_name == module_name && error->error_id == error_id;
+    }
+}
+
+TEST(Constant_Builder, same_values_as_runtime)
+{
+    auto runtime = Build_From_JSON_String<Fields_Numeric>(DEFAULTS_JSON);
+    ASSERT_TRUE(runtime.Has_Value());
+    ASSERT_EQ(DEFAULTS.Get<Fields_Numeric>().tolerance, runtime.Value().Get<Fields_Numeric>().tolerance);
+    ASSERT_EQ(DEFAULTS.Get<Service>().weight, 2.5e-3);
+
+    constexpr auto numbers = Build_From_JSON_Constant<R"({ "numeric": { "tolerance": 123.456 } })", Fields_Numeric>();
+    ASSERT_EQ(numbers.Get<Fields_Numeric>().tolerance, 123.456);
+    constexpr auto small = Build_From_JSON_Constant<R"({ "numeric": { "tolerance": 1e-7 } })", Fields_Numeric>();
+    ASSERT_EQ(small.Get<Fields_Numeric>().tolerance, 1e-7);
+    constexpr auto large = Build_From_JSON_Constant<R"({ "numeric": { "tolerance": 6.02214076E+23 } })", Fields_Numeric>();
+    ASSERT_NEAR(large.Get<Fields_Numeric>().tolerance, 6.02214076e23, 6.02214076e23 * 1e-15);
+    constexpr auto integer = Build_From_JSON_Constant<R"({ "numeric": { "tolerance": 12 } })", Fields_Numeric>();
+    ASSERT_EQ(integer.Get<Fields_Numeric>().tolerance, 12.0);
+}
+
+TEST(Constant_Builder, missing_modules_keep_their_default)
+{
+    constexpr auto empty = Build_From_JSON_Constant<"{}", Fields_Numeric, Service>();
+    ASSERT_EQ(empty.Get<Service>().port, 0);
+    ASSERT_TRUE(empty.Get<Service>().name.empty());
+    ASSERT_FALSE((Validate_JSON_Constant<" { } ", Levels>().has_value()));
+}
+
+TEST(Constant_Builder, errors)
+{
+    static_assert(Fails_With<"{", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<"", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<"{} {}", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<R"({ "a": 01 })", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<R"({ "a": "\ud800" })", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<R"({ "a": 1e400 })", Fields_Numeric>("", JSON_PARSING_FAILED));
+    static_assert(Fails_With<"[1, 2]", Fields_Numeric>("", JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    static_assert(Fails_With<R"({ "numeric": { "tolerance": -1 } })", Fields_Numeric>("numeric", static_cast<int>(Numeric_Error::NOT_POSITIVE)));
+    static_assert(Fails_With<R"({ "numeric": [] })", Fields_Numeric>("numeric", static_cast<int>(Numeric_Error::SHOULD_BE_AND_OBJECT)));
+    static_assert(Fails_With<R"({ "service": { "port": 80 } })", Service>("service", static_cast<int>(Service_Error::NAME_SHOULD_BE_A_STRING)));
+    static_assert(Fails_With<R"({ "service": { "name": "a", "port": 70000 } })", Service>("service", static_cast<int>(Service_Error::PORT_OUT_OF_RANGE)));
+    static_assert(Fails_With<R"({ "service": { "name": "a", "port": 1.5 } })", Service>("service", static_cast<int>(Service_Error::PORT_SHOULD_BE_AN_INT)));
+    static_assert(Fails_With<R"({ "service": { "name": "a", "port": 1, "id": -1 } })", Service>("service", static_cast<int>(Service_Error::ID_SHOULD_BE_AN_UNSIGNED)));
+    static_assert(Fails_With<R"({ "levels": [1, 2, 3, 4, 5] })", Levels>("levels", static_cast<int>(Levels_Error::TOO_MANY_LEVELS)));
+
+    // same errors at runtime
+    auto runtime = Build_From_JSON_String<Fields_Numeric>(R"({ "numeric": { "tolerance": -1 } })");
+    ASSERT_FALSE(runtime.Has_Value());
+    ASSERT_EQ(runtime.Error().error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+}
+
+TEST(Constant_Value, document)
+{
+    static constexpr auto document = Constant_Document<96>::Parse(R"([ null, true, -2147483649, 4294967295, "😀\t", { "k": 1, "k": 2 }, [] ])");
+    static_assert(document.valid);
+
+    constexpr Constant_Value root = document.Root(document.chars.data());
+    static_assert(root.Is_Array() && root.Size() == 7);
+    static_assert(root[0].Is_Null());
+    static_assert(root[1].Is_Bool() && root[1].Get_Bool());
+    static_assert(root[2].Is_Int64() && !root[2].Is_Int() && root[2].Get_Int64() == -2147483649LL);
+    static_assert(root[3].Is_Uint() && !root[3].Is_Int() && root[3].Get_Uint() == 4294967295u);
+    static_assert(root[4].Get_String() == "\xF0\x9F\x98\x80\t");
+    static_assert(root[5].Is_Object() && root[5].Name(1) == "k" && root[5][1].Get_Int() == 2);
+    static_assert(root[5].Find("k")->Get_Int() == 1);
+    static_assert(!root[5].Find("missing").has_value());
+    static_assert(root[6].Is_Array() && root[6].Size() == 0);
+
+    static_assert(!Constant_Document<8>::Parse("[1, 2, 3, 4]").valid);
+    ASSERT_TRUE(root[3].Is_Uint64());
+}
@@ -0,0 +1,120 @@
+// container_diff_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+#include "test_structure_Writer.h"
+
+#include "configuration/application/container_diff.h"
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    struct Label
+    {
+        std::string text;
+
+        bool operator==(const Label&) const = default;
+    };
+
+    enum class Label_Error
+    {
+        SHOULD_BE_A_STRING
+    };
+
+    struct Label_Builder : O::Configuration::Module::JSON_Builder<Label_Builder, Label, Label_Error>
+    {
+        std::optional<Label_Error> Load_From_JSON(const rapidjson::Value& v)
+        {
+            if (!v.IsString())
+                return Label_Error::SHOULD_BE_A_STRING;
+            data.text.assign(v.GetString(), v.GetStringLength());
+            return std::nullopt;
+        }
+
+        static constexpr const char* Key() noexcept { return "label"; }
+    };
+
+    struct Label_Writer : O::Configuration::Module::JSON_Writer<Label_Writer, Label>
+    {
+        template<class W>
+        void To_JSON(W& w, const Label& data) const
+        {
+            w.String(data.text.data(), static_cast<rapidjson::SizeType>(data.text.size()));
+        }
+
+        static constexpr const char* Key() noexcept { return "label"; }
+    };
+
+    using Config = Container<Numeric, Various_Data, Range, Label>;
+
+    Config Make_Config()
+    {
+        Config c;
+        c.Get<Numeric>().tolerance = 0.5;
+        c.Get<Various_Data>().type = Int{ 4 };
+        c.Get<Range>() = Range{ 1, 10 };
+        c.Get<Label>().text = "blue";
+        return c;
+    }
+}
+
+template<>
+struct O::Configuration::Module::Traits<Label>
+{
+    using Builder = Label_Builder;
+    using Writer = Label_Writer;
+};
+
+TEST(Container_Diff, only_changed_modules)
+{
+    const Config from = Make_Config();
+    ASSERT_EQ(Diff_As_JSON_String(from, from), "{}");
+
+    Config to = Make_Config();
+    to.Get<Range>().max = 20;
+    to.Get<Label>().text = "green";
+
+    const std::string diff = Diff_As_JSON_String(from, to);
+    rapidjson::Document doc;
+    doc.Parse(diff.c_str(), diff.size());
+    ASSERT_FALSE(doc.HasParseError());
+    ASSERT_EQ(doc.MemberCount(), 2u);
+    ASSERT_TRUE(doc.HasMember("range"));
+    ASSERT_TRUE(doc.HasMember("label"));
+    ASSERT_LT(diff.size(), Write_As_JSON_String(to).size());
+
+    Config target = Make_Config();
+    ASSERT_FALSE(Apply_JSON_Diff(target, diff).has_value());
+    ASSERT_EQ(Write_As_JSON_String(target), Write_As_JSON_String(to));
+}
+
+TEST(Container_Diff, failed_apply_keeps_target)
+{
+    Config target = Make_Config();
+    const std::string before = Write_As_JSON_String(target);
+
+    // range is valid but label is not, nothing is replaced
+    std::optional<Error> error = Apply_JSON_Diff(target, R"json({ "range": { "min": 0, "max": 1 }, "label": 3 })json");
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->module_name, "label");
+    ASSERT_EQ(error->error_id, static_cast<int>(Label_Error::SHOULD_BE_A_STRING));
+    ASSERT_EQ(Write_As_JSON_String(target), before);
+
+    error = Apply_JSON_Diff(target, R"json({ "range": )json");
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->error_id, static_cast<int>(JSON_PARSING_FAILED));
+
+    error = Apply_JSON_Diff(target, "[]");
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    ASSERT_FALSE(Apply_JSON_Diff(target, "{}").has_value());
+    ASSERT_EQ(Write_As_JSON_String(target), before);
+}
@@ -0,0 +1,283 @@
+// container_fingerprint_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/container_fingerprint.h"
+#include "configuration/application/json_builder.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+// object whose members are kept in document order
+struct Ordered_Weights
+{
+    std::vector<std::pair<std::string, int>> entries;
+};
+
+enum class Ordered_Weights_Error
+{
+    SHOULD_BE_AN_OBJECT_OF_INTS
+};
+
+struct Ordered_Weights_Builder : O::Configuration::Module::JSON_Builder<Ordered_Weights_Builder, Ordered_Weights, Ordered_Weights_Error>
+{
+    static constexpr const char* Key() noexcept { return "weights"; }
+
+    std::optional<Ordered_Weights_Error> Load_From_JSON(const rapidjson::Value& v)
+    {
+        if (!v.IsObject())
+            return Ordered_Weights_Error::SHOULD_BE_AN_OBJECT_OF_INTS;
+        for (auto member = v.MemberBegin(); member != v.MemberEnd(); ++member)
+        {
+            if (!member->value.IsInt())
+                return Ordered_Weights_Error::SHOULD_BE_AN_OBJECT_OF_INTS;
+            data.entries.emplace_back(member->name.GetString(), member->value.GetInt());
+        }
+        return std::nullopt;
+    }
+};
+
+struct Ordered_Weights_Writer : O::Configuration::Module::JSON_Writer<Ordered_Weights_Writer, Ordered_Weights>
+{
+    template<class W>
+    void To_JSON(W& w, const Ordered_Weights& data) const
+    {
+        w.StartObject();
+        for (const auto& [name, weight] : data.entries)
+        {
+            w.Key(name);
+            w.Int(weight);
+        }
+        w.EndObject();
+    }
+
+    static constexpr const char* Key() noexcept { return "weights"; }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Ordered_Weights>
+{
+    using Builder = Ordered_Weights_Builder;
+    using Writer = Ordered_Weights_Writer;
+};
+
+// generation is bookkeeping, it is compared by operator== but not hashed
+struct Peer
+{
+    std::string host;
+    int port = 0;
+    std::uint64_t generation = 0;
+
+    bool operator==(const Peer&) const = default;
+};
+
+struct Peer_Hasher
+{
+    template<class W>
+    void Hash(W& w, const Peer& data) const
+    {
+        w.StartArray();
+        w.String(data.host);
+        w.Int(data.port);
+        w.EndArray();
+    }
+};
+
+struct Peer_Builder : O::Configuration::Module::JSON_Builder<Peer_Builder, Peer, Ordered_Weights_Error>
+{
+    static constexpr const char* Key() noexcept { return "peer"; }
+
+    std::optional<Ordered_Weights_Error> Load_From_JSON(const rapidjson::Value&) { return std::nullopt; }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Peer>
+{
+    using Builder = Peer_Builder;
+    using Hasher = Peer_Hasher;
+};
+
+// no operator==, the label is written but not hashed
+struct Labelled_Gain
+{
+    std::string label;
+    double gain = 0.0;
+};
+
+struct Labelled_Gain_Hasher
+{
+    template<class W>
+    void Hash(W& w, const Labelled_Gain& data) const
+    {
+        w.Double(data.gain);
+    }
+};
+
+struct Labelled_Gain_Builder : O::Configuration::Module::JSON_Builder<Labelled_Gain_Builder, Labelled_Gain, Ordered_Weights_Error>
+{
+    static constexpr const char* Key() noexcept { return "labelled_gain"; }
+
+    std::optional<Ordered_Weights_Error> Load_From_JSON(const rapidjson::Value&) { return std::nullopt; }
+};
+
+struct Labelled_Gain_Writer : O::Configuration::Module::JSON_Writer<Labelled_Gain_Writer, Labelled_Gain>
+{
+    template<class W>
+    void To_JSON(W& w, const Labelled_Gain& data) const
+    {
+        w.StartObject();
+        w.Key("label");
+        w.String(data.label);
+        w.Key("gain");
+        w.Double(data.gain);
+        w.EndObject();
+    }
+
+    static constexpr const char* Key() noexcept { return "labelled_gain"; }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Labelled_Gain>
+{
+    using Builder = Labelled_Gain_Builder;
+    using Writer = Labelled_Gain_Writer;
+    using Hasher = Labelled_Gain_Hasher;
+};
+
+namespace
+{
+    using Fleet = Container<Numeric, Range, Various_Data, Ordered_Weights>;
+
+    Fleet Build_Fleet(const char* json)
+    {
+        auto expected = Build_From_JSON_String<Numeric, Range, Various_Data, Ordered_Weights>(json);
+        EXPECT_TRUE(expected.Has_Value());
+        return std::move(expected).Value();
+    }
+}
+
+TEST(Container_Fingerprint, text_layout_does_not_matter)
+{
+    const Fleet first = Build_Fleet(R"json({
+        "numeric": { "tolerance": 0.5 },
+        "range": { "min": 1, "max": 2 },
+        "various_data": { "type": "double", "value": 2.5 },
+        "weights": { "a": 1, "b": 2 }
+    })json");
+    const Fleet second = Build_Fleet(R"json({ "weights": { "b": 2, "a": 1 }, "range": { "max": 2, "min": 1 },
+        "various_data": { "value": 25e-1, "type": "double" }, "numeric": { "tolerance": 5E-1 } })json");
+
+    ASSERT_NE(first.Get<Ordered_Weights>().entries, second.Get<Ordered_Weights>().entries);
+    ASSERT_EQ(Module_Fingerprint(first.Get<Ordered_Weights>()), Module_Fingerprint(second.Get<Ordered_Weights>()));
+    ASSERT_EQ(Fingerprint(first), Fingerprint(second));
+    // the member order is kept in the data, the containers are not equal
+    ASSERT_FALSE(first == second);
+    ASSERT_TRUE(first == Fleet(first));
+}
+
+TEST(Container_Fingerprint, changed_values_change_the_fingerprint)
+{
+    const Fleet base = Build_Fleet(R"json({ "numeric": { "tolerance": 0.5 }, "range": { "min": 1, "max": 2 }, "weights": { "a": 1, "b": 2 } })json");
+
+    Fleet other = base;
+    ASSERT_TRUE(other == base);
+    other.Get<Range>().max = 3;
+    ASSERT_NE(Fingerprint(other), Fingerprint(base));
+    ASSERT_FALSE(other == base);
+
+    other = base;
+    other.Get<Ordered_Weights>().entries[0].first = "c";
+    ASSERT_NE(Fingerprint(other), Fingerprint(base));
+    ASSERT_TRUE(other != base);
+
+    // the same values moved to other members
+    other = base;
+    std::swap(other.Get<Ordered_Weights>().entries[0].second, other.Get<Ordered_Weights>().entries[1].second);
+    ASSERT_NE(Fingerprint(other), Fingerprint(base));
+
+    other = base;
+    other.Get<Various_Data>().type = Int{ 5 };
+    ASSERT_NE(Fingerprint(other), Fingerprint(base));
+}
+
+TEST(Container_Fingerprint, canonical_numbers)
+{
+    auto digest = [](auto&& write)
+        {
+            Fingerprint_Writer writer;
+            write(writer);
+            return writer.Result();
+        };
+
+    ASSERT_EQ(digest([](auto& w) { w.Int(7); }), digest([](auto& w) { w.Uint64(7); }));
+    ASSERT_EQ(digest([](auto& w) { w.Int64(-7); }), digest([](auto& w) { w.Int(-7); }));
+    ASSERT_NE(digest([](auto& w) { w.Uint64(std::numeric_limits<std::uint64_t>::max()); }), digest([](auto& w) { w.Int64(-1); }));
+    ASSERT_EQ(digest([](auto& w) { w.Double(-0.0); }), digest([](auto& w) { w.Double(0.0); }));
+    ASSERT_EQ(digest([](auto& w) { w.Double(std::nan("1")); }), digest([](auto& w) { w.Double(-std::nan("2")); }));
+    ASSERT_NE(digest([](auto& w) { w.Double(1.0); }), digest([](auto& w) { w.Int(1); }));
+    ASSERT_NE(digest([](auto& w) { w.String("1"); }), digest([](auto& w) { w.Int(1); }));
+
+    // arrays keep their order, objects do not
+    ASSERT_NE(digest([](auto& w) { w.StartArray(); w.Int(1); w.Int(2); w.EndArray(); }),
+              digest([](auto& w) { w.StartArray(); w.Int(2); w.Int(1); w.EndArray(); }));
+    ASSERT_NE(digest([](auto& w) { w.StartArray(); w.EndArray(); }), digest([](auto& w) { w.StartObject(); w.EndObject(); }));
+    ASSERT_EQ(digest([](auto& w) { w.StartObject(); w.Key("x"); w.StartArray(); w.Null(); w.EndArray(); w.Key("y"); w.Bool(true); w.EndObject(); }),
+              digest([](auto& w) { w.StartObject(); w.Key("y"); w.Bool(true); w.Key("x"); w.StartArray(); w.Null(); w.EndArray(); w.EndObject(); }));
+}
+
+TEST(Container_Fingerprint, hasher_hook_and_operator_equal)
+{
+    Container<Peer> left;
+    left.Get<Peer>() = Peer{ "node-1", 8443, 1 };
+    Container<Peer> right = left;
+    right.Get<Peer>().generation = 2;
+
+    ASSERT_EQ(Fingerprint(left), Fingerprint(right));
+    // fields are compared when the module has operator==
+    ASSERT_FALSE(left == right);
+    right.Get<Peer>().generation = 1;
+    ASSERT_TRUE(left == right);
+
+    right.Get<Peer>().port = 443;
+    ASSERT_NE(Fingerprint(left), Fingerprint(right));
+}
+
+TEST(Container_Fingerprint, operator_equal_ignores_the_hasher)
+{
+    Container<Labelled_Gain> left;
+    left.Get<Labelled_Gain>() = Labelled_Gain{ "north", 0.5 };
+    Container<Labelled_Gain> right = left;
+    ASSERT_TRUE(left == right);
+
+    right.Get<Labelled_Gain>().label = "south";
+    ASSERT_EQ(Fingerprint(left), Fingerprint(right));
+    ASSERT_FALSE(left == right);
+
+    // doubles compare as with ==
+    left.Get<Labelled_Gain>() = Labelled_Gain{ "north", -0.0 };
+    right.Get<Labelled_Gain>() = Labelled_Gain{ "north", 0.0 };
+    ASSERT_TRUE(left == right);
+    left.Get<Labelled_Gain>().gain = std::numeric_limits<double>::quiet_NaN();
+    right.Get<Labelled_Gain>().gain = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_EQ(Fingerprint(left), Fingerprint(right));
+    ASSERT_FALSE(left == right);
+    ASSERT_FALSE(left == left);
+}
+
+TEST(Container_Fingerprint, bytes_roundtrip)
+{
+    const Digest digest{ 0x0123456789abcdefull, 0xfedcba9876543210ull };
+    const std::array<unsigned char, 16> bytes = digest.To_Bytes();
+    ASSERT_EQ(bytes[0], 0xef);
+    ASSERT_EQ(bytes[15], 0xfe);
+    ASSERT_EQ(Digest::From_Bytes(bytes), digest);
+}
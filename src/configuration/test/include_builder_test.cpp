@@ -0,0 +1,180 @@
+// include_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/include_builder.h"
+#include "configuration/application/thread_pool.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    void Write_File(const std::filesystem::path& path, const std::string& json)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream out(path, std::ios::trunc);
+        out << json;
+    }
+
+    struct Include_Files
+    {
+        const std::filesystem::path root = "tmp_include";
+
+        Include_Files()
+        {
+            Write_File(root / "fragments" / "bounds.json", R"json({ "min": 1, "max": 9 })json");
+            Write_File(root / "fragments" / "range.json", R"json({ "$include": "bounds.json" })json");
+            Write_File(root / "fragments" / "numeric.json", R"json({ "tolerance": 0.5 })json");
+        }
+
+        ~Include_Files()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(root, ec);
+        }
+
+        std::filesystem::path Service(int index, const std::string& json) const
+        {
+            const std::filesystem::path path = root / ("service_" + std::to_string(index) + ".json");
+            Write_File(path, json);
+            return path;
+        }
+    };
+
+    constexpr const char* SERVICE_JSON = R"json({
+        "range": { "$include": "fragments/range.json" },
+        "numeric": { "$include": "fragments/numeric.json", "tolerance": 0.25 }
+    })json";
+
+    int Error_Of(const Expected_Builder<Numeric, Range>& expected)
+    {
+        EXPECT_FALSE(expected.Has_Value());
+        return expected.Has_Value() ? -1 : expected.Error().error_id;
+    }
+}
+
+TEST(Include_Builder, fragments_are_relative_to_the_including_file)
+{
+    Include_Files files;
+    Fragment_Cache fragments;
+    const std::filesystem::path path = files.Service(0, SERVICE_JSON);
+
+    for (Read_Mode mode : { Read_Mode::STREAM, Read_Mode::MEMORY_MAPPED })
+    {
+        auto expected = Build_From_JSON_File<Numeric, Range>(path, fragments, mode);
+        ASSERT_TRUE(expected.Has_Value());
+        ASSERT_EQ(expected.Value().Get<Range>().min, 1);
+        ASSERT_EQ(expected.Value().Get<Range>().max, 9);
+        // the members next to the directive override the fragment
+        ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.25);
+    }
+    ASSERT_EQ(fragments.Parse_Count(), 3u);
+
+    // the whole root may be included
+    const std::filesystem::path alias = files.Service(1, R"json({ "$include": "service_0.json" })json");
+    Parse_Context context;
+    auto expected = Build_From_JSON_File<Numeric, Range>(alias, context, fragments);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(expected.Value().Get<Range>().max, 9);
+
+    // without a Fragment_Cache the directive is a plain member
+    auto plain = Build_From_JSON_File<Numeric, Range>(path);
+    ASSERT_FALSE(plain.Has_Value());
+    ASSERT_EQ(plain.Error().module_name, "range");
+}
+
+TEST(Include_Builder, cycles_and_invalid_directives)
+{
+    Include_Files files;
+    Fragment_Cache fragments;
+
+    const std::filesystem::path self = files.Service(0, R"json({ "range": { "$include": "service_0.json" } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(self, fragments)), static_cast<int>(INCLUDE_CYCLE));
+
+    Write_File(files.root / "fragments" / "a.json", R"json({ "$include": "b.json" })json");
+    Write_File(files.root / "fragments" / "b.json", R"json({ "$include": "../fragments/a.json" })json");
+    const std::filesystem::path loop = files.Service(1, R"json({ "range": { "$include": "fragments/a.json" } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(loop, fragments)), static_cast<int>(INCLUDE_CYCLE));
+
+    // a fragment included twice is not a cycle
+    const std::filesystem::path twice = files.Service(2, R"json({
+        "range": { "$include": "fragments/range.json" },
+        "numeric": { "$include": "fragments/numeric.json", "unused": { "$include": "fragments/range.json" } }
+    })json");
+    ASSERT_TRUE((Build_From_JSON_File<Numeric, Range>(twice, fragments).Has_Value()));
+
+    const std::filesystem::path not_a_string = files.Service(3, R"json({ "range": { "$include": 3 } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(not_a_string, fragments)), static_cast<int>(INVALID_INCLUDE));
+
+    Write_File(files.root / "fragments" / "array.json", R"json([ 1, 2 ])json");
+    const std::filesystem::path siblings = files.Service(4, R"json({ "range": { "$include": "fragments/array.json", "min": 1 } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(siblings, fragments)), static_cast<int>(INVALID_INCLUDE));
+
+    const std::filesystem::path missing = files.Service(5, R"json({ "range": { "$include": "fragments/missing.json" } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(missing, fragments)), static_cast<int>(FILE_OPENING_FAILED));
+
+    Write_File(files.root / "fragments" / "broken.json", R"json({ "min": )json");
+    const std::filesystem::path broken = files.Service(6, R"json({ "range": { "$include": "fragments/broken.json" } })json");
+    ASSERT_EQ(Error_Of(Build_From_JSON_File<Numeric, Range>(broken, fragments)), static_cast<int>(JSON_PARSING_FAILED));
+}
+
+TEST(Include_Builder, batch_parses_each_fragment_once)
+{
+    Include_Files files;
+    Fragment_Cache fragments;
+
+    // same content under another path shares the parse
+    Write_File(files.root / "fragments" / "numeric_copy.json", R"json({ "tolerance": 0.5 })json");
+
+    std::vector<std::filesystem::path> paths;
+    for (int i = 0; i < 32; ++i)
+        paths.push_back(files.Service(i, i % 2 == 0 ? SERVICE_JSON : R"json({
+            "range": { "$include": "fragments/range.json" },
+            "numeric": { "$include": "fragments/numeric_copy.json" }
+        })json"));
+
+    Thread_Pool pool(4);
+    auto results = Build_From_JSON_Files<Numeric, Range>(paths, pool, fragments);
+    ASSERT_EQ(results.size(), paths.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        ASSERT_TRUE(results[i].Has_Value());
+        ASSERT_EQ(results[i].Value().Get<Range>().max, 9);
+        ASSERT_DOUBLE_EQ(results[i].Value().Get<Numeric>().tolerance, i % 2 == 0 ? 0.25 : 0.5);
+    }
+    // concurrent first loads of one content may each parse it, the cache keeps a single copy
+    ASSERT_EQ(fragments.Size(), 4u);
+
+    const std::size_t parsed = fragments.Parse_Count();
+    Build_From_JSON_Files<Numeric, Range>(paths, pool, fragments);
+    ASSERT_EQ(fragments.Parse_Count(), parsed);
+
+    // an edited fragment is parsed again
+    Write_File(files.root / "fragments" / "bounds.json", R"json({ "min": 2, "max": 10 })json");
+    auto edited = Build_From_JSON_File<Numeric, Range>(paths[0], fragments);
+    ASSERT_TRUE(edited.Has_Value());
+    ASSERT_EQ(edited.Value().Get<Range>().max, 10);
+    ASSERT_EQ(fragments.Parse_Count(), parsed + 1);
+
+    fragments.Clear();
+    ASSERT_EQ(fragments.Size(), 0u);
+}
+
+TEST(Include_Builder, shared_cache)
+{
+    Include_Files files;
+    const std::filesystem::path path = files.Service(0, SERVICE_JSON);
+
+    ASSERT_EQ(&Fragment_Cache::Shared(), &Fragment_Cache::Shared());
+    auto expected = Build_From_JSON_File<Numeric, Range>(path, Fragment_Cache::Shared());
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(expected.Value().Get<Range>().min, 1);
+}
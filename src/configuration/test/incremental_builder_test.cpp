@@ -0,0 +1,139 @@
+// incremental_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/incremental_builder.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    using Shared = Shared_Container<Numeric, Various_Data, Range>;
+
+    constexpr auto BASE_JSON = R"json({
+        "numeric": { "tolerance": 0.5 },
+        "various_data": { "type": "int", "value": 4 },
+        "range": { "min": 1, "max": 2 }
+    })json";
+
+    Shared Build_Base()
+    {
+        auto expected = Rebuild_From_JSON_String(BASE_JSON, Shared{});
+        EXPECT_TRUE(expected.Has_Value());
+        return std::move(expected).Value();
+    }
+}
+
+TEST(Incremental_Builder, first_build_builds_every_module)
+{
+    Shared base = Build_Base();
+    ASSERT_DOUBLE_EQ(base.Get<Numeric>().tolerance, 0.5);
+    ASSERT_EQ(std::get<Int>(base.Get<Various_Data>().type).value, 4);
+    ASSERT_EQ(base.Get<Range>().max, 2);
+    for (const auto& fingerprint : base.fingerprints)
+        ASSERT_TRUE(fingerprint.has_value());
+
+    Container<Numeric, Various_Data, Range> plain = base.To_Container();
+    ASSERT_EQ(plain.Get<Range>().min, 1);
+}
+
+TEST(Incremental_Builder, unchanged_modules_are_shared)
+{
+    Shared base = Build_Base();
+
+    // whitespace and member order of the root do not matter, only the module values
+    auto expected = Rebuild_From_JSON_String(R"json({ "range": { "min": 1, "max": 2 },
+        "various_data": { "type": "int", "value": 4 },   "numeric": { "tolerance": 0.75 } })json", base);
+    ASSERT_TRUE(expected.Has_Value());
+    const Shared& next = expected.Value();
+
+    ASSERT_NE(next.Get_Shared<Numeric>(), base.Get_Shared<Numeric>());
+    ASSERT_DOUBLE_EQ(next.Get<Numeric>().tolerance, 0.75);
+    ASSERT_EQ(next.Get_Shared<Various_Data>(), base.Get_Shared<Various_Data>());
+    ASSERT_EQ(next.Get_Shared<Range>(), base.Get_Shared<Range>());
+
+    // the previous container is untouched
+    ASSERT_DOUBLE_EQ(base.Get<Numeric>().tolerance, 0.5);
+}
+
+TEST(Incremental_Builder, removed_module_is_reset)
+{
+    Shared base = Build_Base();
+
+    auto expected = Rebuild_From_JSON_String(R"json({
+        "numeric": { "tolerance": 0.5 },
+        "various_data": { "type": "int", "value": 4 }
+    })json", base);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(expected.Value().Get<Range>().min, 0);
+    ASSERT_EQ(expected.Value().Get<Range>().max, 0);
+    ASSERT_EQ(expected.Value().Get_Shared<Numeric>(), base.Get_Shared<Numeric>());
+
+    // still absent, still shared
+    auto again = Rebuild_From_JSON_String(R"json({ "numeric": { "tolerance": 0.5 }, "various_data": { "type": "int", "value": 4 } })json", expected.Value());
+    ASSERT_TRUE(again.Has_Value());
+    ASSERT_EQ(again.Value().Get_Shared<Range>(), expected.Value().Get_Shared<Range>());
+}
+
+TEST(Incremental_Builder, value_changes_are_detected)
+{
+    Shared base = Build_Base();
+
+    for (const char* json : {
+        R"json({ "numeric": { "tolerance": 0.5 }, "various_data": { "type": "double", "value": 4 }, "range": { "min": 1, "max": 2 } })json",
+        R"json({ "numeric": { "tolerance": 0.5 }, "various_data": { "type": "int", "value": 5 }, "range": { "min": 1, "max": 2 } })json",
+        R"json({ "numeric": { "tolerance": 0.5 }, "various_data": { "value": 4, "type": "int" }, "range": { "min": 1, "max": 2 } })json" })
+    {
+        auto expected = Rebuild_From_JSON_String(json, base);
+        ASSERT_TRUE(expected.Has_Value());
+        ASSERT_NE(expected.Value().Get_Shared<Various_Data>(), base.Get_Shared<Various_Data>());
+        ASSERT_EQ(expected.Value().Get_Shared<Numeric>(), base.Get_Shared<Numeric>());
+    }
+}
+
+TEST(Incremental_Builder, errors_keep_previous)
+{
+    Shared base = Build_Base();
+
+    auto module_error = Rebuild_From_JSON_String(R"json({ "range": { "min": 3, "max": 2 } })json", base);
+    ASSERT_FALSE(module_error.Has_Value());
+    ASSERT_EQ(module_error.Error().module_name, std::string_view("range"));
+    ASSERT_EQ(module_error.Error().error_id, static_cast<int>(Range_Error::MIN_GREATER_THAN_MAX));
+
+    auto root_error = Rebuild_From_JSON_String("[1, 2]", base);
+    ASSERT_FALSE(root_error.Has_Value());
+    ASSERT_EQ(root_error.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    ASSERT_EQ(base.Get<Range>().min, 1);
+}
+
+TEST(Incremental_Builder, from_file_with_context)
+{
+    const std::filesystem::path p = "temp_incremental.json";
+    {
+        std::ofstream ofs(p, std::ios::binary);
+        ofs << BASE_JSON;
+    }
+
+    Parse_Context context;
+    auto first = Rebuild_From_JSON_File(p, Shared{}, context);
+    ASSERT_TRUE(first.Has_Value());
+    auto second = Rebuild_From_JSON_File(p, first.Value(), context, Read_Mode::MEMORY_MAPPED);
+    ASSERT_TRUE(second.Has_Value());
+    ASSERT_EQ(second.Value().Get_Shared<Numeric>(), first.Value().Get_Shared<Numeric>());
+    ASSERT_EQ(second.Value().Get_Shared<Range>(), first.Value().Get_Shared<Range>());
+
+    auto missing = Rebuild_From_JSON_File("this_file_should_not_exist_12345.json", first.Value());
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
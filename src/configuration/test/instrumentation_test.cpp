@@ -0,0 +1,179 @@
+// instrumentation_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+#include "test_structure_Writer.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+#include "configuration/application/parse_context.h"
+#include "configuration/application/trace_recorder.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    const std::string input = R"json({ "numeric": { "tolerance": 0.5 }, "range": { "min": 1, "max": 2 } })json";
+
+    // fake allocation totals moving by one allocation of 8 bytes on each call
+    std::size_t probe_calls = 0;
+    Allocation_Totals Counting_Probe()
+    {
+        ++probe_calls;
+        return Allocation_Totals{ probe_calls, probe_calls * 8 };
+    }
+}
+
+TEST(Instrumentation, records_parse_and_each_load)
+{
+    Trace_Recorder recorder;
+    Parse_Context context;
+    auto result = Build_From_JSON_String<Numeric, Range>(input, context, recorder);
+    ASSERT_TRUE(result.Has_Value());
+    ASSERT_EQ(std::get<Numeric>(result.Value().modules).tolerance, 0.5);
+
+    const std::vector<Trace_Event>& events = recorder.Events();
+    ASSERT_EQ(events.size(), 3u);
+    ASSERT_EQ(events[0].phase, Phase::PARSE);
+    ASSERT_EQ(events[0].size, input.size());
+    ASSERT_EQ(events[1].phase, Phase::LOAD);
+    ASSERT_EQ(events[1].key, "numeric");
+    ASSERT_EQ(events[1].size, std::string(R"json({"tolerance":0.5})json").size());
+    ASSERT_EQ(events[2].key, "range");
+    ASSERT_EQ(events[2].size, std::string(R"json({"min":1,"max":2})json").size());
+    ASSERT_GE(events[2].start_ns, events[1].start_ns);
+
+    Trace_Stats stats = recorder.Stats();
+    ASSERT_EQ(stats.parses, 1u);
+    ASSERT_EQ(stats.parse_input_bytes, input.size());
+    ASSERT_EQ(stats.modules.size(), 2u);
+    ASSERT_NE(stats.Find("range"), nullptr);
+    ASSERT_EQ(stats.Find("range")->loads, 1u);
+    ASSERT_EQ(stats.Find("range")->writes, 0u);
+    ASSERT_EQ(stats.Find("various_data"), nullptr);
+}
+
+TEST(Instrumentation, reports_parse_failures)
+{
+    Trace_Recorder recorder;
+    Parse_Context context;
+    ASSERT_FALSE((Build_From_JSON_String<Numeric, Range>(R"json({ "numeric": )json", context, recorder).Has_Value()));
+    ASSERT_EQ(recorder.Events().size(), 1u);
+    ASSERT_EQ(recorder.Events()[0].phase, Phase::PARSE);
+
+    // loading stops at the failing module
+    recorder.Clear();
+    ASSERT_FALSE((Build_From_JSON_String<Numeric, Range>(R"json({ "numeric": { "tolerance": -1 }, "range": {} })json", context, recorder).Has_Value()));
+    ASSERT_EQ(recorder.Events().size(), 2u);
+    ASSERT_EQ(recorder.Events()[1].key, "numeric");
+}
+
+TEST(Instrumentation, file_matches_plain_build)
+{
+    const std::filesystem::path path = "tmp_instrumentation.json";
+    std::ofstream(path, std::ios::binary) << input;
+
+    Parse_Context context;
+    for (Read_Mode mode : { Read_Mode::STREAM, Read_Mode::MEMORY_MAPPED })
+    {
+        Trace_Recorder recorder;
+        auto traced = Build_From_JSON_File<Numeric, Range>(path, context, recorder, mode);
+        No_Instrumentation nothing;
+        auto untraced = Build_From_JSON_File<Numeric, Range>(path, context, nothing, mode);
+        auto plain = Build_From_JSON_File<Numeric, Range>(path, mode);
+        ASSERT_TRUE(traced.Has_Value());
+        ASSERT_TRUE(untraced.Has_Value());
+        ASSERT_TRUE(plain.Has_Value());
+        ASSERT_EQ(std::get<Range>(traced.Value().modules).max, std::get<Range>(plain.Value().modules).max);
+        ASSERT_EQ(std::get<Range>(untraced.Value().modules).max, std::get<Range>(plain.Value().modules).max);
+
+        ASSERT_EQ(recorder.Stats().parse_input_bytes, input.size());
+        ASSERT_EQ(recorder.Stats().modules.size(), 2u);
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+TEST(Instrumentation, records_each_write)
+{
+    Container<Numeric, Range> container;
+    std::get<Range>(container.modules) = Range{ 3, 4 };
+
+    Trace_Recorder recorder;
+    std::string traced;
+    Write_As_JSON_String(container, traced, recorder);
+    ASSERT_EQ(traced, Write_As_JSON_String(container));
+
+    Trace_Stats stats = recorder.Stats();
+    ASSERT_EQ(stats.parses, 0u);
+    ASSERT_EQ(stats.modules.size(), 2u);
+    ASSERT_EQ(stats.modules[0].key, "numeric");
+    ASSERT_EQ(stats.Find("range")->writes, 1u);
+    // the separator after the key is written with the module value
+    ASSERT_EQ(stats.Find("range")->output_bytes, std::string(R"json(:{"min":3,"max":4})json").size());
+
+    // the file overload reports the same sizes
+    const std::filesystem::path path = "tmp_instrumentation_write.json";
+    Trace_Recorder file_recorder;
+    ASSERT_FALSE(Write_As_JSON_File(container, path, File_Write_Options{}, file_recorder).has_value());
+    ASSERT_EQ(file_recorder.Stats().Find("range")->output_bytes, stats.Find("range")->output_bytes);
+    ASSERT_EQ(file_recorder.Stats().Find("numeric")->output_bytes, stats.Find("numeric")->output_bytes);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+TEST(Instrumentation, allocation_probe)
+{
+    probe_calls = 0;
+    Trace_Recorder recorder(&Counting_Probe);
+    Parse_Context context;
+    ASSERT_TRUE((Build_From_JSON_String<Numeric, Range>(input, context, recorder).Has_Value()));
+
+    // each step reads the probe when it begins and when it ends
+    Trace_Stats stats = recorder.Stats();
+    ASSERT_EQ(probe_calls, 6u);
+    ASSERT_EQ(stats.parse_allocations, 1u);
+    ASSERT_EQ(stats.Find("numeric")->allocations, 1u);
+    ASSERT_EQ(stats.Find("numeric")->allocated_bytes, 8u);
+}
+
+TEST(Instrumentation, chrome_trace)
+{
+    Trace_Recorder recorder;
+    Parse_Context context;
+    ASSERT_TRUE((Build_From_JSON_String<Numeric, Range>(input, context, recorder).Has_Value()));
+
+    const std::filesystem::path path = "tmp_instrumentation.trace.json";
+    ASSERT_FALSE(recorder.Write_Chrome_Trace(path).has_value());
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    ASSERT_EQ(content.str(), recorder.Chrome_Trace_JSON());
+
+    rapidjson::Document doc;
+    doc.Parse(content.str().c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    const rapidjson::Value& events = doc["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    ASSERT_EQ(events.Size(), 3u);
+    ASSERT_EQ(std::string(events[0u]["name"].GetString()), "parse");
+    ASSERT_EQ(std::string(events[1u]["name"].GetString()), "numeric");
+    ASSERT_EQ(std::string(events[1u]["cat"].GetString()), "load");
+    ASSERT_EQ(std::string(events[2u]["ph"].GetString()), "X");
+    ASSERT_EQ(events[2u]["args"]["size"].GetUint64(), std::string(R"json({"min":1,"max":2})json").size());
+
+    file.close();
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
@@ -0,0 +1,186 @@
+// json_columnar_test.cpp
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+#include "configuration/module/json_columnar.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/stream.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+struct Routes
+{
+    std::vector<std::uint64_t> id;
+    std::vector<std::string> prefix;
+    std::vector<unsigned> metric;
+    std::vector<bool> enabled;
+};
+
+enum class Routes_Error
+{
+    SHOULD_BE_AN_ARRAY_OF_OBJECTS,
+    ID_SHOULD_BE_AN_UNSIGNED,
+    IDS_SHOULD_INCREASE,
+    PREFIX_SHOULD_BE_A_STRING,
+    METRIC_SHOULD_BE_AN_UNSIGNED,
+    METRIC_TOO_LARGE,
+    ENABLED_SHOULD_BE_A_BOOL
+};
+
+struct Routes_Records
+{
+    using Data = Routes;
+    using Error = Routes_Error;
+
+    static constexpr std::size_t CHUNK_SIZE = 4;
+
+    static constexpr const char* Key() noexcept { return "routes"; }
+    static constexpr Routes_Error Not_An_Array_Error() noexcept { return Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS; }
+
+    static constexpr auto Columns() noexcept
+    {
+        using namespace O::Configuration::Module;
+        return std::tuple{
+            Column{ "id", &Routes::id, Routes_Error::ID_SHOULD_BE_AN_UNSIGNED },
+            Column{ "prefix", &Routes::prefix, Routes_Error::PREFIX_SHOULD_BE_A_STRING },
+            Column{ "metric", &Routes::metric, Routes_Error::METRIC_SHOULD_BE_AN_UNSIGNED,
+                [](unsigned metric) { return metric > 1000 ? std::optional(Routes_Error::METRIC_TOO_LARGE) : std::nullopt; } },
+            Optional_Column{ "enabled", &Routes::enabled, Routes_Error::ENABLED_SHOULD_BE_A_BOOL }
+        };
+    }
+
+    static inline std::vector<std::size_t> chunk_sizes;
+
+    template<class Chunk>
+    static std::optional<Routes_Error> Validate_Chunk(const Routes& data, const Chunk& chunk)
+    {
+        const auto& ids = std::get<0>(chunk);
+        chunk_sizes.push_back(ids.size());
+        std::uint64_t previous = data.id.empty() ? 0 : data.id.back();
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            if ((i != 0 || !data.id.empty()) && ids[i] <= previous)
+                return Routes_Error::IDS_SHOULD_INCREASE;
+            previous = ids[i];
+        }
+        return std::nullopt;
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Routes>
+{
+    using Builder = O::Configuration::Module::JSON_Columnar_Builder<Routes_Records>;
+    using Writer = O::Configuration::Module::JSON_Columnar_Writer<Routes_Records>;
+};
+
+namespace
+{
+    std::string Routes_Json(std::size_t count)
+    {
+        std::string json = R"({ "routes": [)";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json += i == 0 ? "" : ",";
+            json += R"({ "prefix": "10.0.)" + std::to_string(i) + R"(.0/24", "id": )" + std::to_string(i + 1) + R"(, "metric": )" + std::to_string(i * 10);
+            if (i % 3 == 0)
+                json += R"(, "enabled": true)";
+            json += " }";
+        }
+        return json + "] }";
+    }
+
+    Expected_Builder<Routes> Stream(const std::string& json)
+    {
+        rapidjson::StringStream is(json.c_str());
+        return Build_From_JSON_Stream<Routes>(is);
+    }
+
+    bool Fails_With(const std::string& routes, Routes_Error error)
+    {
+        auto expected = Stream(R"({ "routes": )" + routes + " }");
+        return !expected.Has_Value() && expected.Error().module_name == "routes" && expected.Error().error_id == static_cast<int>(error);
+    }
+}
+
+TEST(JSON_Columnar, stream_in_chunks)
+{
+    Routes_Records::chunk_sizes.clear();
+    auto expected = Stream(Routes_Json(10));
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(Routes_Records::chunk_sizes, (std::vector<std::size_t>{ 4, 4, 2 }));
+
+    const Routes& routes = expected.Value().Get<Routes>();
+    ASSERT_EQ(routes.id.size(), 10u);
+    ASSERT_EQ(routes.prefix.size(), 10u);
+    ASSERT_EQ(routes.metric.size(), 10u);
+    ASSERT_EQ(routes.enabled.size(), 10u);
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(routes.id[i], i + 1);
+        ASSERT_EQ(routes.prefix[i], "10.0." + std::to_string(i) + ".0/24");
+        ASSERT_EQ(routes.metric[i], i * 10);
+        ASSERT_EQ(routes.enabled[i], i % 3 == 0);
+    }
+}
+
+TEST(JSON_Columnar, document_and_writer_round_trip)
+{
+    auto streamed = Stream(Routes_Json(9));
+    auto from_document = Build_From_JSON_String<Routes>(Routes_Json(9));
+    ASSERT_TRUE(streamed.Has_Value());
+    ASSERT_TRUE(from_document.Has_Value());
+
+    const std::string json = Write_As_JSON_String(streamed.Value());
+    ASSERT_EQ(Write_As_JSON_String(from_document.Value()), json);
+    ASSERT_EQ(json.find(R"({"routes":[{"id":1,"prefix":"10.0.0.0/24","metric":0,"enabled":true},{"id":2,)"), 0u);
+
+    auto rebuilt = Stream(json);
+    ASSERT_TRUE(rebuilt.Has_Value());
+    ASSERT_EQ(rebuilt.Value().Get<Routes>().enabled, streamed.Value().Get<Routes>().enabled);
+    ASSERT_EQ(Write_As_JSON_String(rebuilt.Value()), json);
+
+    auto empty = Stream(R"({ "routes": [] })");
+    ASSERT_TRUE(empty.Has_Value());
+    ASSERT_TRUE(empty.Value().Get<Routes>().id.empty());
+    ASSERT_EQ(Write_As_JSON_String(empty.Value()), R"({"routes":[]})");
+}
+
+TEST(JSON_Columnar, unknown_and_duplicated_members)
+{
+    auto expected = Stream(R"({ "routes": [
+        { "id": 1, "prefix": "a", "metric": 1, "id": 7, "extra": { "nested": [1, { "deep": null }] } },
+        { "tags": ["x"], "id": 2, "prefix": "b", "metric": 2, "enabled": false }
+    ] })");
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(expected.Value().Get<Routes>().id, (std::vector<std::uint64_t>{ 1, 2 }));
+    ASSERT_EQ(expected.Value().Get<Routes>().prefix, (std::vector<std::string>{ "a", "b" }));
+}
+
+TEST(JSON_Columnar, errors)
+{
+    ASSERT_TRUE(Fails_With(R"({ "id": 1 })", Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS));
+    ASSERT_TRUE(Fails_With(R"(3)", Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS));
+    ASSERT_TRUE(Fails_With(R"([1])", Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS));
+    ASSERT_TRUE(Fails_With(R"([[]])", Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS));
+    ASSERT_TRUE(Fails_With(R"([{ "id": 1, "metric": 1 }])", Routes_Error::PREFIX_SHOULD_BE_A_STRING));
+    ASSERT_TRUE(Fails_With(R"([{ "id": -1, "prefix": "a", "metric": 1 }])", Routes_Error::ID_SHOULD_BE_AN_UNSIGNED));
+    ASSERT_TRUE(Fails_With(R"([{ "id": 1, "prefix": ["a"], "metric": 1 }])", Routes_Error::PREFIX_SHOULD_BE_A_STRING));
+    ASSERT_TRUE(Fails_With(R"([{ "id": 1, "prefix": "a", "metric": 1001 }])", Routes_Error::METRIC_TOO_LARGE));
+    ASSERT_TRUE(Fails_With(R"([{ "id": 1, "prefix": "a", "metric": 1, "enabled": null }])", Routes_Error::ENABLED_SHOULD_BE_A_BOOL));
+
+    // checked per chunk: the second chunk breaks the order at its first record
+    std::string unordered = Routes_Json(6);
+    unordered.replace(unordered.find(R"("id": 5)"), 7, R"("id": 4)");
+    auto expected = Stream(unordered);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Routes_Error::IDS_SHOULD_INCREASE));
+
+    auto from_document = Build_From_JSON_String<Routes>(R"({ "routes": { "id": 1 } })");
+    ASSERT_FALSE(from_document.Has_Value());
+    ASSERT_EQ(from_document.Error().error_id, static_cast<int>(Routes_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS));
+}
@@ -0,0 +1,164 @@
+// json_fields_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_writer.h"
+#include "configuration/module/json_fields.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+struct Endpoint
+{
+    std::string host;
+    int port = 0;
+    bool secure = false;
+    double timeout = 1.5;
+    std::uint64_t weight = 1;
+};
+
+enum class Endpoint_Error
+{
+    SHOULD_BE_AN_OBJECT,
+    HOST_SHOULD_BE_A_STRING,
+    PORT_SHOULD_BE_AN_INT,
+    PORT_OUT_OF_RANGE,
+    SECURE_SHOULD_BE_A_BOOL,
+    TIMEOUT_SHOULD_BE_A_NUMBER,
+    WEIGHT_SHOULD_BE_AN_UNSIGNED
+};
+
+struct Endpoint_Fields
+{
+    using Data = Endpoint;
+    using Error = Endpoint_Error;
+
+    static constexpr const char* Key() noexcept { return "endpoint"; }
+    static constexpr Endpoint_Error Not_An_Object_Error() noexcept { return Endpoint_Error::SHOULD_BE_AN_OBJECT; }
+
+    static constexpr auto Fields() noexcept
+    {
+        using namespace O::Configuration::Module;
+        return std::tuple{
+            Field{ "host", &Endpoint::host, Endpoint_Error::HOST_SHOULD_BE_A_STRING },
+            Field{ "port", &Endpoint::port, Endpoint_Error::PORT_SHOULD_BE_AN_INT,
+                [](int port) { return port > 0 && port < 65536 ? std::nullopt : std::optional(Endpoint_Error::PORT_OUT_OF_RANGE); } },
+            Optional_Field{ "secure", &Endpoint::secure, Endpoint_Error::SECURE_SHOULD_BE_A_BOOL },
+            Optional_Field{ "timeout", &Endpoint::timeout, Endpoint_Error::TIMEOUT_SHOULD_BE_A_NUMBER },
+            Optional_Field{ "weight", &Endpoint::weight, Endpoint_Error::WEIGHT_SHOULD_BE_AN_UNSIGNED }
+        };
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Endpoint>
+{
+    using Builder = O::Configuration::Module::JSON_Fields_Builder<Endpoint_Fields>;
+    using Writer = O::Configuration::Module::JSON_Fields_Writer<Endpoint_Fields>;
+};
+
+namespace
+{
+    std::optional<Endpoint_Error> Load(const char* json, Endpoint* out = nullptr)
+    {
+        rapidjson::Document doc;
+        doc.Parse(json);
+        O::Configuration::Module::JSON_Fields_Builder<Endpoint_Fields> builder;
+        auto error = builder.Load_From_JSON(doc);
+        if (out)
+            *out = *builder;
+        return error;
+    }
+
+    std::optional<Endpoint_Error> Validate(const char* json)
+    {
+        rapidjson::Document doc;
+        doc.Parse(json);
+        O::Configuration::Module::JSON_Fields_Builder<Endpoint_Fields> builder;
+        auto error = builder.Validate_JSON(doc);
+        // nothing is loaded into the builder data
+        EXPECT_TRUE(builder.data.host.empty());
+        EXPECT_EQ(builder.data.port, 0);
+        return error;
+    }
+}
+
+TEST(JSON_Fields, loads_every_field)
+{
+    Endpoint endpoint;
+    ASSERT_FALSE(Load(R"json({ "weight": 7, "port": 443, "host": "example.org", "unknown": [1, 2], "secure": true, "timeout": 2 })json", &endpoint));
+    ASSERT_EQ(endpoint.host, "example.org");
+    ASSERT_EQ(endpoint.port, 443);
+    ASSERT_TRUE(endpoint.secure);
+    ASSERT_DOUBLE_EQ(endpoint.timeout, 2.0);
+    ASSERT_EQ(endpoint.weight, 7u);
+}
+
+TEST(JSON_Fields, optional_fields_keep_defaults)
+{
+    Endpoint endpoint;
+    ASSERT_FALSE(Load(R"json({ "host": "localhost", "port": 80 })json", &endpoint));
+    ASSERT_FALSE(endpoint.secure);
+    ASSERT_DOUBLE_EQ(endpoint.timeout, 1.5);
+    ASSERT_EQ(endpoint.weight, 1u);
+}
+
+TEST(JSON_Fields, first_occurrence_wins)
+{
+    Endpoint endpoint;
+    ASSERT_FALSE(Load(R"json({ "host": "first", "port": 80, "host": 12 })json", &endpoint));
+    ASSERT_EQ(endpoint.host, "first");
+}
+
+TEST(JSON_Fields, errors)
+{
+    ASSERT_EQ(Load("[]"), Endpoint_Error::SHOULD_BE_AN_OBJECT);
+    ASSERT_EQ(Load(R"json({ "port": 80 })json"), Endpoint_Error::HOST_SHOULD_BE_A_STRING);
+    ASSERT_EQ(Load(R"json({ "host": "h", "port": 1.5 })json"), Endpoint_Error::PORT_SHOULD_BE_AN_INT);
+    ASSERT_EQ(Load(R"json({ "host": "h", "port": 70000 })json"), Endpoint_Error::PORT_OUT_OF_RANGE);
+    ASSERT_EQ(Load(R"json({ "host": "h", "port": 80, "secure": 1 })json"), Endpoint_Error::SECURE_SHOULD_BE_A_BOOL);
+    ASSERT_EQ(Load(R"json({ "host": "h", "port": 80, "weight": -1 })json"), Endpoint_Error::WEIGHT_SHOULD_BE_AN_UNSIGNED);
+
+    // the first field in declaration order is reported, whatever the member order
+    ASSERT_EQ(Load(R"json({ "timeout": "slow", "port": 0, "host": 3 })json"), Endpoint_Error::HOST_SHOULD_BE_A_STRING);
+    ASSERT_EQ(Load(R"json({ "timeout": "slow", "host": "h" })json"), Endpoint_Error::PORT_SHOULD_BE_AN_INT);
+}
+
+TEST(JSON_Fields, validate_matches_load)
+{
+    for (const char* json : {
+        "[]",
+        R"json({ "port": 80 })json",
+        R"json({ "host": "h", "port": 1.5 })json",
+        R"json({ "host": "h", "port": 70000 })json",
+        R"json({ "host": "h", "port": 80, "secure": 1 })json",
+        R"json({ "timeout": "slow", "port": 0, "host": 3 })json",
+        R"json({ "weight": 7, "port": 443, "host": "example.org", "unknown": [1, 2], "secure": true, "timeout": 2 })json" })
+    {
+        ASSERT_EQ(Validate(json), Load(json)) << json;
+    }
+}
+
+TEST(JSON_Fields, writer_roundtrip)
+{
+    auto expected = Build_From_JSON_String<Endpoint, Fields_Numeric>(
+        R"json({ "endpoint": { "host": "a\"b", "port": 8080, "weight": 18446744073709551615 }, "numeric": { "tolerance": 0.5 } })json");
+    ASSERT_TRUE(expected.Has_Value());
+
+    const std::string json = Write_As_JSON_String(expected.Value());
+    auto again = Build_From_JSON_String<Endpoint, Fields_Numeric>(json);
+    ASSERT_TRUE(again.Has_Value());
+    const Endpoint& endpoint = again.Value().Get<Endpoint>();
+    ASSERT_EQ(endpoint.host, "a\"b");
+    ASSERT_EQ(endpoint.port, 8080);
+    ASSERT_FALSE(endpoint.secure);
+    ASSERT_DOUBLE_EQ(endpoint.timeout, 1.5);
+    ASSERT_EQ(endpoint.weight, 18446744073709551615ull);
+    ASSERT_DOUBLE_EQ(again.Value().Get<Fields_Numeric>().tolerance, 0.5);
+}
@@ -0,0 +1,85 @@
+// key_dispatch_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/key_dispatch.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    constexpr const char* KEYS[] = {
+        "http", "https", "tls", "acl", "routes", "limits", "dns", "cache", "log", "metrics",
+        "trace", "auth", "users", "groups", "quota", "proxy", "upstream", "health", "retry", "timeout",
+        "cors", "headers", "cookies", "session", "storage", "queue", "workers", "threads", "pool", "io",
+        "a", "b", "ab", "ba", "aa", "bb", "abc", "cab", "bca", "" };
+
+    template<int I>
+    struct Keyed {};
+}
+
+template<int I>
+struct O::Configuration::Module::Traits<Keyed<I>>
+{
+    struct Builder
+    {
+        static constexpr const char* Key() noexcept { return KEYS[I]; }
+    };
+};
+
+template<std::size_t... Is>
+constexpr bool Every_Key_Is_Found(std::index_sequence<Is...>)
+{
+    using Table = Detail::Key_Table<Keyed<Is>...>;
+    return ((Table::Find(KEYS[Is]) == Is) && ...) && Table::Find("unknown") == Table::COUNT && Table::Find("http ") == Table::COUNT;
+}
+
+static_assert(Every_Key_Is_Found(std::make_index_sequence<std::size(KEYS)>{}));
+static_assert(Detail::Key_Table<>::Find("numeric") == 0);
+
+TEST(Key_Dispatch, find_module_index)
+{
+    using Table = Detail::Key_Table<Numeric, Various_Data, Range>;
+    ASSERT_EQ(Table::Find("numeric"), 0u);
+    ASSERT_EQ(Table::Find("various_data"), 1u);
+    ASSERT_EQ(Table::Find("range"), 2u);
+    ASSERT_EQ(Table::Find("rang"), Table::COUNT);
+    ASSERT_EQ(Table::Find(std::string("numeric\0", 8)), Table::COUNT);
+}
+
+TEST(Key_Dispatch, several_modules_with_unknown_and_repeated_keys)
+{
+    constexpr auto json = R"json({
+        "unknown": 1,
+        "range": { "min": 1, "max": 2 },
+        "numeric": { "tolerance": 0.75 },
+        "numeric": { "tolerance": -1 },
+        "various_data": { "type": "null" }
+    })json";
+
+    auto expected = Build_From_JSON_String<Numeric, Various_Data, Range>(json);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.75);
+    ASSERT_TRUE(std::holds_alternative<Null>(expected.Value().Get<Various_Data>().type));
+    ASSERT_EQ(expected.Value().Get<Range>().max, 2);
+}
+
+TEST(Key_Dispatch, first_error_in_module_order)
+{
+    constexpr auto json = R"json({
+        "range": { "min": 3, "max": 2 },
+        "numeric": { "tolerance": -1 }
+    })json";
+
+    auto expected = Build_From_JSON_String<Numeric, Range>(json);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().module_name, std::string_view("numeric"));
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+}
@@ -0,0 +1,176 @@
+// layered_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/layered_builder.h"
+#include "configuration/module/json_columnar.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+struct Mirrors
+{
+    std::vector<std::string> host;
+};
+
+enum class Mirrors_Error
+{
+    SHOULD_BE_AN_ARRAY_OF_OBJECTS,
+    HOST_SHOULD_BE_A_STRING
+};
+
+struct Mirrors_Records
+{
+    using Data = Mirrors;
+    using Error = Mirrors_Error;
+
+    static constexpr const char* Key() noexcept { return "mirrors"; }
+    static constexpr Mirrors_Error Not_An_Array_Error() noexcept { return Mirrors_Error::SHOULD_BE_AN_ARRAY_OF_OBJECTS; }
+
+    static constexpr auto Columns() noexcept
+    {
+        return std::tuple{ O::Configuration::Module::Column{ "host", &Mirrors::host, Mirrors_Error::HOST_SHOULD_BE_A_STRING } };
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Mirrors>
+{
+    using Builder = O::Configuration::Module::JSON_Columnar_Builder<Mirrors_Records>;
+};
+
+namespace
+{
+    void Write_Layer(const std::filesystem::path& path, const std::string& json)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << json;
+    }
+
+    struct Layer_Files
+    {
+        std::array<std::filesystem::path, 3> paths = { "tmp_layer_base.json", "tmp_layer_environment.json", "tmp_layer_host.json" };
+
+        Layer_Files()
+        {
+            Write_Layer(paths[0], R"json({
+                "numeric": { "tolerance": 0.5 },
+                "range": { "min": 1, "max": 2 },
+                "mirrors": [ { "host": "a" }, { "host": "b" } ]
+            })json");
+            Write_Layer(paths[1], R"json({ "range": { "max": 5 }, "mirrors": [ { "host": "c" } ], "unknown": [ 1 ] })json");
+            Write_Layer(paths[2], R"json({ "numeric": { "tolerance": 0.25 } })json");
+        }
+
+        ~Layer_Files()
+        {
+            std::error_code ec;
+            for (const std::filesystem::path& path : paths)
+                std::filesystem::remove(path, ec);
+        }
+    };
+}
+
+TEST(Layered_Builder, objects_merge_and_arrays_replace)
+{
+    Layer_Files files;
+
+    auto expected = Build_From_JSON_Layers<Numeric, Range, Mirrors>(files.paths);
+    ASSERT_TRUE(expected.Has_Value());
+    const auto& container = expected.Value();
+    ASSERT_DOUBLE_EQ(container.Get<Numeric>().tolerance, 0.25);
+    ASSERT_EQ(container.Get<Range>().min, 1);
+    ASSERT_EQ(container.Get<Range>().max, 5);
+    ASSERT_EQ(container.Get<Mirrors>().host, std::vector<std::string>{ "c" });
+
+    // the base alone
+    auto base = Build_From_JSON_Layers<Numeric, Range, Mirrors>(std::span(files.paths).first(1));
+    ASSERT_TRUE(base.Has_Value());
+    ASSERT_EQ(base.Value().Get<Range>().max, 2);
+    ASSERT_EQ(base.Value().Get<Mirrors>().host, (std::vector<std::string>{ "a", "b" }));
+}
+
+TEST(Layered_Builder, value_that_is_not_an_object_hides_lower_layers)
+{
+    Layer_Files files;
+    Write_Layer(files.paths[1], R"json({ "range": 3 })json");
+    Write_Layer(files.paths[2], R"json({ "range": { "max": 8 } })json");
+
+    // the base min is hidden by the environment layer
+    auto expected = Build_From_JSON_Layers<Range>(files.paths);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().module_name, "range");
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Range_Error::MISSING_BOUND));
+
+    Write_Layer(files.paths[2], R"json({ "range": { "min": 7, "max": 8 } })json");
+    auto replaced = Build_From_JSON_Layers<Range>(files.paths);
+    ASSERT_TRUE(replaced.Has_Value());
+    ASSERT_EQ(replaced.Value().Get<Range>().min, 7);
+}
+
+TEST(Layered_Builder, cache_parses_only_changed_layers)
+{
+    Layer_Files files;
+    Layer_Cache cache;
+
+    ASSERT_TRUE((Build_From_JSON_Layers<Numeric, Range, Mirrors>(files.paths, cache).Has_Value()));
+    ASSERT_EQ(cache.Size(), 3u);
+    ASSERT_EQ(cache.Parse_Count(), 3u);
+
+    ASSERT_TRUE((Build_From_JSON_Layers<Numeric, Range, Mirrors>(files.paths, cache).Has_Value()));
+    ASSERT_EQ(cache.Parse_Count(), 3u);
+
+    // a new modification time with the same content is only hashed
+    std::filesystem::last_write_time(files.paths[0], std::filesystem::last_write_time(files.paths[0]) + std::chrono::seconds(2));
+    ASSERT_TRUE((Build_From_JSON_Layers<Numeric, Range, Mirrors>(files.paths, cache).Has_Value()));
+    ASSERT_EQ(cache.Parse_Count(), 3u);
+
+    Write_Layer(files.paths[2], R"json({ "numeric": { "tolerance": 0.125 } })json");
+    auto expected = Build_From_JSON_Layers<Numeric, Range, Mirrors>(files.paths, cache);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.125);
+    ASSERT_EQ(expected.Value().Get<Range>().max, 5);
+    ASSERT_EQ(cache.Parse_Count(), 4u);
+
+    cache.Clear();
+    ASSERT_EQ(cache.Size(), 0u);
+}
+
+TEST(Layered_Builder, layer_errors)
+{
+    Layer_Files files;
+    Layer_Cache cache;
+    ASSERT_TRUE((Build_From_JSON_Layers<Numeric, Range>(files.paths, cache).Has_Value()));
+
+    Write_Layer(files.paths[1], R"json({ "range": )json");
+    auto invalid = Build_From_JSON_Layers<Numeric, Range>(files.paths, cache);
+    ASSERT_FALSE(invalid.Has_Value());
+    ASSERT_EQ(invalid.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+    ASSERT_EQ(cache.Size(), 2u);
+
+    Write_Layer(files.paths[1], R"json([ { "range": { "max": 5 } } ])json");
+    auto not_an_object = Build_From_JSON_Layers<Numeric, Range>(files.paths, cache);
+    ASSERT_FALSE(not_an_object.Has_Value());
+    ASSERT_EQ(not_an_object.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    Write_Layer(files.paths[1], R"json({ "range": { "max": 0.5 } })json");
+    auto module_error = Build_From_JSON_Layers<Numeric, Range>(files.paths, cache);
+    ASSERT_FALSE(module_error.Has_Value());
+    ASSERT_EQ(module_error.Error().module_name, "range");
+    ASSERT_EQ(module_error.Error().error_id, static_cast<int>(Range_Error::SHOULD_BE_AN_INT));
+
+    std::error_code ec;
+    std::filesystem::remove(files.paths[2], ec);
+    auto missing = Build_From_JSON_Layers<Numeric, Range>(files.paths, cache);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
@@ -0,0 +1,140 @@
+// lazy_container_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/lazy_container.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    struct Counted
+    {
+        int value = 0;
+    };
+
+    enum class Counted_Error
+    {
+        SHOULD_BE_AN_INT
+    };
+
+    std::atomic<int> counted_loads = 0;
+
+    struct Counted_Builder : O::Configuration::Module::JSON_Builder<Counted_Builder, Counted, Counted_Error>
+    {
+        std::optional<Counted_Error> Load_From_JSON(const rapidjson::Value& v)
+        {
+            ++counted_loads;
+            if (!v.IsInt())
+                return Counted_Error::SHOULD_BE_AN_INT;
+            data.value = v.GetInt();
+            return std::nullopt;
+        }
+
+        static constexpr const char* Key() noexcept { return "counted"; }
+    };
+}
+
+template<>
+struct O::Configuration::Module::Traits<Counted>
+{
+    using Builder = Counted_Builder;
+};
+
+TEST(Lazy_Container, builds_on_first_access)
+{
+    counted_loads = 0;
+    auto lazy = Build_Lazy_From_JSON_String<Numeric, Counted, Range>(R"json({ "counted": 7, "numeric": { "tolerance": 0.5 } })json");
+    ASSERT_TRUE(lazy.Has_Value());
+    const auto& container = lazy.Value();
+
+    ASSERT_EQ(counted_loads, 0);
+    ASSERT_FALSE(container.Is_Materialized<Counted>());
+
+    const auto& counted = container.Get<Counted>();
+    ASSERT_TRUE(counted.Has_Value());
+    ASSERT_EQ(counted.Value().value, 7);
+    ASSERT_EQ(&container.Get<Counted>(), &counted);
+    ASSERT_EQ(counted_loads, 1);
+    ASSERT_TRUE(container.Is_Materialized<Counted>());
+    ASSERT_FALSE(container.Is_Materialized<Numeric>());
+
+    // missing modules are default constructed
+    ASSERT_TRUE(container.Get<Range>().Has_Value());
+    ASSERT_EQ(container.Get<Range>().Value().min, Range{}.min);
+
+    ASSERT_FALSE(container.Materialize_All().has_value());
+    ASSERT_DOUBLE_EQ(container.Get<Numeric>().Value().tolerance, 0.5);
+    ASSERT_EQ(counted_loads, 1);
+}
+
+TEST(Lazy_Container, concurrent_first_access)
+{
+    counted_loads = 0;
+    auto lazy = Build_Lazy_From_JSON_String<Counted>(R"json({ "counted": 3 })json");
+    ASSERT_TRUE(lazy.Has_Value());
+    const auto& container = lazy.Value();
+
+    std::atomic<int> sum = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+        threads.emplace_back([&] { sum += container.Get<Counted>().Value().value; });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(sum, 24);
+    ASSERT_EQ(counted_loads, 1);
+}
+
+TEST(Lazy_Container, errors)
+{
+    auto lazy = Build_Lazy_From_JSON_String<Numeric, Counted, Range>(R"json({ "range": { "min": 2, "max": 1 }, "counted": "x" })json");
+    ASSERT_TRUE(lazy.Has_Value());
+
+    // Materialize_All reports the first error in module order
+    std::optional<Error> error = lazy.Value().Materialize_All();
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->module_name, "counted");
+    ASSERT_EQ(error->error_id, static_cast<int>(Counted_Error::SHOULD_BE_AN_INT));
+
+    const auto& range = lazy.Value().Get<Range>();
+    ASSERT_FALSE(range.Has_Value());
+    ASSERT_EQ(range.Error().error_id, static_cast<int>(Range_Error::MIN_GREATER_THAN_MAX));
+
+    auto broken = Build_Lazy_From_JSON_String<Numeric>(R"json({ "numeric": )json");
+    ASSERT_FALSE(broken.Has_Value());
+    ASSERT_EQ(broken.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+
+    auto not_object = Build_Lazy_From_JSON_String<Numeric>("[]");
+    ASSERT_FALSE(not_object.Has_Value());
+    ASSERT_EQ(not_object.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+}
+
+TEST(Lazy_Container, file)
+{
+    const std::filesystem::path path = "tmp_lazy_container.json";
+    std::ofstream(path, std::ios::binary) << R"json({ "various_data": { "type": "int", "value": 12 }, "numeric": { "tolerance": 1.25 } })json";
+
+    auto lazy = Build_Lazy_From_JSON_File<Numeric, Various_Data>(path);
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    ASSERT_TRUE(lazy.Has_Value());
+    auto container = std::move(lazy).Value();
+    ASSERT_DOUBLE_EQ(container.Get<Numeric>().Value().tolerance, 1.25);
+    ASSERT_EQ(std::get<Int>(container.Get<Various_Data>().Value().type).value, 12);
+
+    auto missing = Build_Lazy_From_JSON_File<Numeric>(path);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
@@ -0,0 +1,175 @@
+// live_configuration_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/live_configuration.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace O::Configuration::Application;
+using namespace std::chrono_literals;
+
+namespace
+{
+    void Write_File(const std::filesystem::path& p, const std::string& content)
+    {
+        std::ofstream ofs(p, std::ios::binary | std::ios::trunc);
+        ofs << content;
+    }
+
+    // replace the file the way editors and deployment tools do
+    void Replace_File(const std::filesystem::path& p, const std::string& content)
+    {
+        std::filesystem::path tmp = p;
+        tmp += ".tmp";
+        Write_File(tmp, content);
+        std::filesystem::rename(tmp, p);
+    }
+
+    template<class Predicate>
+    bool Wait_For(Predicate predicate)
+    {
+        for (auto end = std::chrono::steady_clock::now() + 5s; std::chrono::steady_clock::now() < end; std::this_thread::sleep_for(5ms))
+            if (predicate())
+                return true;
+        return false;
+    }
+
+    std::string Numeric_Json(double tolerance)
+    {
+        return R"json({ "numeric": { "tolerance": )json" + std::to_string(tolerance) + " } }";
+    }
+}
+
+TEST(Live_Configuration, reload_publishes_snapshot)
+{
+    const std::filesystem::path p = "temp_live_reload.json";
+    Write_File(p, Numeric_Json(0.5));
+
+    Live_Configuration<Numeric> live(p);
+    ASSERT_EQ(live.Snapshot(), nullptr);
+    ASSERT_FALSE(live.Reload().has_value());
+    ASSERT_EQ(live.Generation(), 1u);
+
+    auto first = live.Snapshot();
+    ASSERT_NE(first, nullptr);
+    ASSERT_DOUBLE_EQ(first->Get<Numeric>().tolerance, 0.5);
+
+    Write_File(p, Numeric_Json(0.75));
+    ASSERT_FALSE(live.Reload().has_value());
+    ASSERT_DOUBLE_EQ(live.Snapshot()->Get<Numeric>().tolerance, 0.75);
+
+    // a reader holding the old snapshot keeps it
+    ASSERT_DOUBLE_EQ(first->Get<Numeric>().tolerance, 0.5);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Live_Configuration, failed_reload_keeps_snapshot)
+{
+    const std::filesystem::path p = "temp_live_failure.json";
+    Write_File(p, Numeric_Json(0.5));
+
+    Live_Configuration<Numeric> live(p);
+    ASSERT_FALSE(live.Reload().has_value());
+
+    Write_File(p, R"json({ "numeric": { "tolerance": -2 } })json");
+    auto error = live.Reload();
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->module_name, std::string_view("numeric"));
+    ASSERT_EQ(error->error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+    ASSERT_EQ(live.Generation(), 1u);
+    ASSERT_DOUBLE_EQ(live.Snapshot()->Get<Numeric>().tolerance, 0.5);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Live_Configuration, snapshot_cache_reads_only_the_generation)
+{
+    using Cache = Detail::Snapshot_Cache<std::shared_ptr<const int>>;
+    std::atomic<std::shared_ptr<const int>> snapshot{ std::make_shared<const int>(1) };
+    std::atomic<std::uint64_t> generation{ 1 };
+    const std::uint64_t source = Cache::Next_Source();
+
+    const auto first = Cache::Load(source, snapshot, generation);
+    ASSERT_EQ(*first, 1);
+
+    // stored without a new generation: the fast path returns the cached copy without reading snapshot
+    snapshot.store(std::make_shared<const int>(2));
+    ASSERT_EQ(Cache::Load(source, snapshot, generation), first);
+
+    generation.fetch_add(1);
+    ASSERT_EQ(*Cache::Load(source, snapshot, generation), 2);
+
+    // another source read from the same thread
+    std::atomic<std::shared_ptr<const int>> other{ std::make_shared<const int>(3) };
+    ASSERT_EQ(*Cache::Load(Cache::Next_Source(), other, generation), 3);
+
+    // each thread has its own copy
+    int seen = 0;
+    std::thread([&] { seen = *Cache::Load(source, snapshot, generation); }).join();
+    ASSERT_EQ(seen, 2);
+}
+
+class Live_Configuration_Watch : public ::testing::TestWithParam<bool> {};
+
+TEST_P(Live_Configuration_Watch, rebuilds_on_change_and_reports_errors)
+{
+    const std::filesystem::path p = std::string("temp_live_watch_") + (GetParam() ? "polling" : "notify") + ".json";
+    Write_File(p, Numeric_Json(1));
+
+    std::atomic<int> errors = 0;
+    std::atomic<int> last_error = -1;
+    Live_Options options;
+    options.debounce = 10ms;
+    options.poll_interval = 20ms;
+    options.force_polling = GetParam();
+
+    Live_Configuration<Numeric> live(p, [&](const Error& error)
+        {
+            last_error = error.error_id;
+            ++errors;
+        }, options);
+    ASSERT_FALSE(live.Reload().has_value());
+    live.Start();
+    ASSERT_TRUE(live.Is_Watching());
+
+    // the polling watcher compares modification times, leave it a tick to record the first one
+    std::this_thread::sleep_for(50ms);
+
+    Replace_File(p, Numeric_Json(2));
+    ASSERT_TRUE(Wait_For([&] { return live.Snapshot()->Get<Numeric>().tolerance == 2.0; }));
+
+    Write_File(p, R"json({ "numeric": )json");
+    ASSERT_TRUE(Wait_For([&] { return errors.load() > 0; }));
+    ASSERT_EQ(last_error.load(), static_cast<int>(JSON_PARSING_FAILED));
+    ASSERT_DOUBLE_EQ(live.Snapshot()->Get<Numeric>().tolerance, 2.0);
+
+    std::this_thread::sleep_for(50ms);
+    Write_File(p, Numeric_Json(3) + "    ");
+    ASSERT_TRUE(Wait_For([&] { return live.Snapshot()->Get<Numeric>().tolerance == 3.0; }));
+
+    live.Stop();
+    ASSERT_FALSE(live.Is_Watching());
+    const std::uint64_t generation = live.Generation();
+    Replace_File(p, Numeric_Json(4));
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(live.Generation(), generation);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+INSTANTIATE_TEST_SUITE_P(Watchers, Live_Configuration_Watch, ::testing::Values(false, true));
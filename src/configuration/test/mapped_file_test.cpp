@@ -0,0 +1,106 @@
+// mapped_file_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/mapped_file.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    std::filesystem::path Write_Temp_File(const std::string& filename, const std::string& content)
+    {
+        std::ofstream ofs(filename, std::ios::binary);
+        ofs << content;
+        return filename;
+    }
+}
+
+TEST(Mapped_File, content_is_null_terminated_and_private)
+{
+    const std::string content = R"json({ "numeric": { "tolerance": 0.5 } })json";
+    const std::filesystem::path p = Write_Temp_File("temp_mapped.json", content);
+
+    {
+        auto file = Mapped_File::Open(p);
+        ASSERT_TRUE(file.has_value());
+        ASSERT_EQ(file->Size(), content.size());
+        ASSERT_EQ(std::string(file->Data()), content);
+
+        // writes stay in the private mapping
+        file->Data()[0] = 'X';
+    }
+
+    std::ifstream ifs(p, std::ios::binary);
+    ASSERT_EQ(std::string(std::istreambuf_iterator<char>(ifs), {}), content);
+    ifs.close();
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Mapped_File, size_multiple_of_page)
+{
+    std::string content = R"json({ "numeric": { "tolerance": 0.125 } })json";
+    content.resize(64 * 1024, ' ');
+    const std::filesystem::path p = Write_Temp_File("temp_mapped_page.json", content);
+
+    auto file = Mapped_File::Open(p);
+    ASSERT_TRUE(file.has_value());
+    ASSERT_EQ(std::strlen(file->Data()), content.size());
+
+    auto expected = Build_From_JSON_File<Numeric>(p, Read_Mode::MEMORY_MAPPED);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.125);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Mapped_File, same_result_as_stream)
+{
+    const std::filesystem::path p = Write_Temp_File("temp_mapped_modules.json", R"json({
+        "various_data": { "type": "int", "value": 7 },
+        "range": { "min": -3, "max": 9 }
+    })json");
+
+    auto stream = Build_From_JSON_File<Various_Data, Range>(p);
+    auto mapped = Build_From_JSON_File<Various_Data, Range>(p, Read_Mode::MEMORY_MAPPED);
+    ASSERT_TRUE(stream.Has_Value());
+    ASSERT_TRUE(mapped.Has_Value());
+    ASSERT_EQ(std::get<Int>(mapped.Value().Get<Various_Data>().type).value, std::get<Int>(stream.Value().Get<Various_Data>().type).value);
+    ASSERT_EQ(mapped.Value().Get<Range>().min, -3);
+    ASSERT_EQ(mapped.Value().Get<Range>().max, 9);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Mapped_File, empty_file_fails_to_parse)
+{
+    const std::filesystem::path p = Write_Temp_File("temp_mapped_empty.json", "");
+
+    auto expected = Build_From_JSON_File<Numeric>(p, Read_Mode::MEMORY_MAPPED);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
+
+TEST(Mapped_File, file_open_error)
+{
+    std::filesystem::path p("this_file_should_not_exist_12345.json");
+    auto expected = Build_From_JSON_File<Numeric>(p, Read_Mode::MEMORY_MAPPED);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
@@ -0,0 +1,135 @@
+// parallel_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/thread_pool.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <latch>
+#include <stdexcept>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+TEST(Thread_Pool, runs_every_task)
+{
+    for (std::size_t threads : { 0u, 1u, 4u })
+    {
+        Thread_Pool pool(threads);
+        ASSERT_EQ(pool.Size(), threads);
+
+        std::atomic<int> sum = 0;
+        std::vector<Thread_Pool::Task> tasks;
+        for (int i = 1; i <= 100; ++i)
+            tasks.emplace_back([&sum, i] { sum += i; });
+        pool.Run(tasks);
+        ASSERT_EQ(sum.load(), 5050);
+    }
+}
+
+TEST(Thread_Pool, tasks_run_concurrently)
+{
+    Thread_Pool pool(1);
+    std::latch both_started(2);
+    std::vector<Thread_Pool::Task> tasks(2, [&both_started] { both_started.arrive_and_wait(); });
+    pool.Run(tasks);
+}
+
+TEST(Thread_Pool, nested_run_does_not_deadlock)
+{
+    Thread_Pool pool(2);
+    std::atomic<int> count = 0;
+    std::vector<Thread_Pool::Task> inner(8, [&count] { ++count; });
+    std::vector<Thread_Pool::Task> outer(8, [&] { pool.Run(inner); });
+    pool.Run(outer);
+    ASSERT_EQ(count.load(), 64);
+}
+
+// the group lives on the stack of Run, the last worker must be done with it when Run returns
+TEST(Thread_Pool, many_small_groups)
+{
+    Thread_Pool pool(4);
+    std::atomic<int> count = 0;
+    std::vector<Thread_Pool::Task> tasks(2, [&count] { ++count; });
+    for (int i = 0; i < 20000; ++i)
+        pool.Run(tasks);
+    ASSERT_EQ(count.load(), 40000);
+}
+
+TEST(Thread_Pool, first_exception_in_task_order)
+{
+    Thread_Pool pool(3);
+    std::atomic<int> count = 0;
+    std::vector<Thread_Pool::Task> tasks = {
+        [&count] { ++count; },
+        [] { throw std::runtime_error("first"); },
+        [&count] { ++count; },
+        [] { throw std::logic_error("second"); } };
+    try
+    {
+        pool.Run(tasks);
+        FAIL() << "Run should rethrow";
+    }
+    catch (const std::runtime_error& e)
+    {
+        ASSERT_STREQ(e.what(), "first");
+    }
+    ASSERT_EQ(count.load(), 2);
+}
+
+TEST(Parallel_Builder, same_result_as_sequential)
+{
+    constexpr auto json = R"json({
+        "numeric": { "tolerance": 0.5 },
+        "various_data": { "type": "double", "value": 2.5 },
+        "range": { "min": -1, "max": 7 }
+    })json";
+
+    Parse_Context context;
+    auto parallel = Build_From_JSON_String<Numeric, Various_Data, Range>(json, context, Thread_Pool::Shared());
+    ASSERT_TRUE(parallel.Has_Value());
+    ASSERT_DOUBLE_EQ(parallel.Value().Get<Numeric>().tolerance, 0.5);
+    ASSERT_DOUBLE_EQ(std::get<Double>(parallel.Value().Get<Various_Data>().type).value, 2.5);
+    ASSERT_EQ(parallel.Value().Get<Range>().min, -1);
+    ASSERT_EQ(parallel.Value().Get<Range>().max, 7);
+}
+
+TEST(Parallel_Builder, first_error_in_module_order)
+{
+    // numeric and range both fail, numeric comes first in the Container
+    constexpr auto json = R"json({
+        "range": { "min": 3, "max": 2 },
+        "various_data": { "type": "int", "value": 1 },
+        "numeric": { "tolerance": -1 }
+    })json";
+
+    Thread_Pool pool(4);
+    for (int i = 0; i < 50; ++i)
+    {
+        auto expected = Build_From_JSON_String<Numeric, Various_Data, Range>(json, pool);
+        ASSERT_FALSE(expected.Has_Value());
+        ASSERT_EQ(expected.Error().module_name, std::string_view("numeric"));
+        ASSERT_EQ(expected.Error().error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+    }
+
+    auto swapped = Build_From_JSON_String<Range, Various_Data, Numeric>(json, pool);
+    ASSERT_FALSE(swapped.Has_Value());
+    ASSERT_EQ(swapped.Error().module_name, std::string_view("range"));
+}
+
+TEST(Parallel_Builder, document_errors)
+{
+    Thread_Pool pool(2);
+
+    auto root = Build_From_JSON_String<Numeric>("[]", pool);
+    ASSERT_FALSE(root.Has_Value());
+    ASSERT_EQ(root.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+
+    auto missing = Build_From_JSON_File<Numeric>("this_file_should_not_exist_12345.json", pool);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+}
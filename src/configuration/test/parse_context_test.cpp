@@ -0,0 +1,111 @@
+// parse_context_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/parse_context.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    std::string Large_Json(double tolerance)
+    {
+        std::string json = "{";
+        for (int i = 0; i < 500; ++i)
+            json += "\"unknown_" + std::to_string(i) + "\": { \"text\": \"some value that takes room in the pool\" }, ";
+        json += "\"numeric\": { \"tolerance\": " + std::to_string(tolerance) + " } }";
+        return json;
+    }
+}
+
+TEST(Parse_Context, repeated_string_builds)
+{
+    Parse_Context context;
+
+    auto first = Build_From_JSON_String<Numeric, Range>(R"json({ "numeric": { "tolerance": 0.5 }, "range": { "min": 1, "max": 2 } })json", context);
+    ASSERT_TRUE(first.Has_Value());
+    ASSERT_DOUBLE_EQ(first.Value().Get<Numeric>().tolerance, 0.5);
+
+    auto second = Build_From_JSON_String<Numeric, Range>(R"json({ "range": { "min": 3, "max": 4 } })json", context);
+    ASSERT_TRUE(second.Has_Value());
+    ASSERT_DOUBLE_EQ(second.Value().Get<Numeric>().tolerance, Numeric{}.tolerance);
+    ASSERT_EQ(second.Value().Get<Range>().min, 3);
+
+    // the results do not depend on the context once built
+    ASSERT_EQ(first.Value().Get<Range>().max, 2);
+}
+
+TEST(Parse_Context, errors_do_not_poison_the_context)
+{
+    Parse_Context context;
+
+    auto broken = Build_From_JSON_String<Numeric>(R"json({ "numeric": { "tolerance": )json", context);
+    ASSERT_FALSE(broken.Has_Value());
+    ASSERT_EQ(broken.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+
+    auto invalid = Build_From_JSON_String<Numeric>(R"json({ "numeric": { "tolerance": -1 } })json", context);
+    ASSERT_FALSE(invalid.Has_Value());
+    ASSERT_EQ(invalid.Error().error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+
+    auto valid = Build_From_JSON_String<Numeric>(R"json({ "numeric": { "tolerance": 2 } })json", context);
+    ASSERT_TRUE(valid.Has_Value());
+    ASSERT_DOUBLE_EQ(valid.Value().Get<Numeric>().tolerance, 2.0);
+}
+
+TEST(Parse_Context, pools_grow_once_then_stay)
+{
+    Parse_Context context(1024);
+    const std::size_t initial_capacity = context.Value_Pool_Capacity();
+
+    ASSERT_TRUE(Build_From_JSON_String<Numeric>(Large_Json(1), context).Has_Value());
+    ASSERT_GT(context.Value_Pool_Capacity(), initial_capacity);
+
+    ASSERT_TRUE(Build_From_JSON_String<Numeric>(Large_Json(2), context).Has_Value());
+    const std::size_t value_capacity = context.Value_Pool_Capacity();
+    const std::size_t stack_capacity = context.Stack_Pool_Capacity();
+
+    for (int i = 3; i < 10; ++i)
+    {
+        auto expected = Build_From_JSON_String<Numeric>(Large_Json(i), context);
+        ASSERT_TRUE(expected.Has_Value());
+        ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, i);
+        ASSERT_EQ(context.Value_Pool_Capacity(), value_capacity);
+        ASSERT_EQ(context.Stack_Pool_Capacity(), stack_capacity);
+    }
+}
+
+TEST(Parse_Context, file_builds_in_both_modes)
+{
+    const std::filesystem::path p = "temp_parse_context.json";
+    {
+        std::ofstream ofs(p, std::ios::binary);
+        ofs << Large_Json(0.25);
+    }
+
+    Parse_Context context;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto stream = Build_From_JSON_File<Numeric>(p, context);
+        ASSERT_TRUE(stream.Has_Value());
+        ASSERT_DOUBLE_EQ(stream.Value().Get<Numeric>().tolerance, 0.25);
+
+        auto mapped = Build_From_JSON_File<Numeric>(p, context, Read_Mode::MEMORY_MAPPED);
+        ASSERT_TRUE(mapped.Has_Value());
+        ASSERT_DOUBLE_EQ(mapped.Value().Get<Numeric>().tolerance, 0.25);
+    }
+
+    auto missing = Build_From_JSON_File<Numeric>("this_file_should_not_exist_12345.json", context);
+    ASSERT_FALSE(missing.Has_Value());
+    ASSERT_EQ(missing.Error().error_id, static_cast<int>(FILE_OPENING_FAILED));
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
@@ -0,0 +1,148 @@
+// parse_policy_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/parse_context.h"
+#include "configuration/application/parse_policy.h"
+#include "configuration/module/json_fields.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/stream.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+struct Label
+{
+    std::string text;
+};
+
+enum class Label_Error
+{
+    SHOULD_BE_AN_OBJECT,
+    TEXT_SHOULD_BE_A_STRING
+};
+
+struct Label_Fields
+{
+    using Data = Label;
+    using Error = Label_Error;
+
+    static constexpr const char* Key() noexcept { return "label"; }
+    static constexpr Label_Error Not_An_Object_Error() noexcept { return Label_Error::SHOULD_BE_AN_OBJECT; }
+
+    static constexpr auto Fields() noexcept
+    {
+        return std::tuple{ O::Configuration::Module::Field{ "text", &Label::text, Label_Error::TEXT_SHOULD_BE_A_STRING } };
+    }
+};
+
+template<>
+struct O::Configuration::Module::Traits<Label>
+{
+    using Builder = O::Configuration::Module::JSON_Fields_Builder<Label_Fields>;
+};
+
+namespace
+{
+    constexpr const char* RELAXED_JSON = R"json({
+        // edited by hand
+        "numeric": { "tolerance": 0.25, },
+        /* trailing commas */
+        "range": { "min": 1, "max": 2 },
+    })json";
+
+    bool Parse_Failed(const Expected_Builder<Numeric, Range>& expected)
+    {
+        return !expected.Has_Value() && expected.Error().error_id == static_cast<int>(JSON_PARSING_FAILED);
+    }
+
+    void Expect_Relaxed_Values(const Expected_Builder<Numeric, Range>& expected)
+    {
+        ASSERT_TRUE(expected.Has_Value());
+        ASSERT_EQ(expected.Value().Get<Numeric>().tolerance, 0.25);
+        ASSERT_EQ(expected.Value().Get<Range>().max, 2);
+    }
+}
+
+TEST(Parse_Policy, relaxed_string_and_stream)
+{
+    ASSERT_TRUE(Parse_Failed(Build_From_JSON_String<Numeric, Range>(RELAXED_JSON)));
+    ASSERT_TRUE(Parse_Failed(Build_From_JSON_String<Numeric, Range>(RELAXED_JSON, Default_Parse{})));
+    Expect_Relaxed_Values(Build_From_JSON_String<Numeric, Range>(RELAXED_JSON, Relaxed_Parse{}));
+
+    Parse_Context context;
+    Expect_Relaxed_Values(Build_From_JSON_String<Numeric, Range>(RELAXED_JSON, context, Relaxed_Parse{}));
+    ASSERT_TRUE(Parse_Failed(Build_From_JSON_String<Numeric, Range>(RELAXED_JSON, context)));
+
+    rapidjson::StringStream strict_stream(RELAXED_JSON);
+    ASSERT_TRUE(Parse_Failed(Build_From_JSON_Stream<Numeric, Range>(strict_stream)));
+    rapidjson::StringStream relaxed_stream(RELAXED_JSON);
+    Expect_Relaxed_Values(Build_From_JSON_Stream<Numeric, Range>(relaxed_stream, Relaxed_Parse{}));
+}
+
+TEST(Parse_Policy, relaxed_file)
+{
+    const std::filesystem::path path = "tmp_parse_policy.json";
+    {
+        std::ofstream out(path);
+        out << RELAXED_JSON;
+    }
+
+    Parse_Context context;
+    for (Read_Mode mode : { Read_Mode::STREAM, Read_Mode::MEMORY_MAPPED })
+    {
+        ASSERT_TRUE(Parse_Failed(Build_From_JSON_File<Numeric, Range>(path, mode)));
+        Expect_Relaxed_Values(Build_From_JSON_File<Numeric, Range>(path, Relaxed_Parse{}, mode));
+        Expect_Relaxed_Values(Build_From_JSON_File<Numeric, Range>(path, context, Relaxed_Parse{}, mode));
+        // INSITU is ignored by the file builders
+        Expect_Relaxed_Values(Build_From_JSON_File<Numeric, Range>(path, context, Parse_Policy<INSITU | COMMENTS | TRAILING_COMMAS>{}, mode));
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+TEST(Parse_Policy, fast_insitu_string)
+{
+    const std::string json = R"json({ "label": { "text": "in \"place\"" }, "numeric": { "tolerance": 0.5 } })json";
+
+    Parse_Context context;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto expected = Build_From_JSON_String<Label, Numeric>(json, context, Fast_Parse{});
+        ASSERT_TRUE(expected.Has_Value());
+        ASSERT_EQ(expected.Value().Get<Label>().text, "in \"place\"");
+        ASSERT_EQ(expected.Value().Get<Numeric>().tolerance, 0.5);
+    }
+
+    // the caller text is left untouched
+    ASSERT_EQ(json, R"json({ "label": { "text": "in \"place\"" }, "numeric": { "tolerance": 0.5 } })json");
+
+    auto without_context = Build_From_JSON_String<Label>(R"json({ "label": { "text": "in \"place\"" } })json", Fast_Parse{});
+    ASSERT_TRUE(without_context.Has_Value());
+    ASSERT_EQ(without_context.Value().Get<Label>().text, "in \"place\"");
+
+    auto invalid = Build_From_JSON_String<Label>(R"json({ "label": )json", Fast_Parse{});
+    ASSERT_FALSE(invalid.Has_Value());
+    ASSERT_EQ(invalid.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+}
+
+TEST(Parse_Policy, strict_utf8)
+{
+    const std::string json = std::string(R"json({ "label": { "text": ")json") + "\xC3\x28" + R"json(" } })json";
+
+    ASSERT_TRUE(Build_From_JSON_String<Label>(json).Has_Value());
+    auto strict = Build_From_JSON_String<Label>(json, Strict_Parse{});
+    ASSERT_FALSE(strict.Has_Value());
+    ASSERT_EQ(strict.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+
+    auto valid = Build_From_JSON_String<Label>(R"json({ "label": { "text": "café ✓" } })json", Strict_Parse{});
+    ASSERT_TRUE(valid.Has_Value());
+    ASSERT_EQ(valid.Value().Get<Label>().text, "caf\xC3\xA9 \xE2\x9C\x93");
+}
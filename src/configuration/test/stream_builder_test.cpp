@@ -0,0 +1,115 @@
+// stream_builder_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/stream.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace O::Configuration::Application;
+
+TEST(Stream_Builder, sax_module_from_string)
+{
+    rapidjson::StringStream is(R"json({ "range": { "min": -2, "max": 40 } })json");
+
+    auto expected = Build_From_JSON_Stream<Range>(is);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_EQ(expected.Value().Get<Range>().min, -2);
+    ASSERT_EQ(expected.Value().Get<Range>().max, 40);
+}
+
+TEST(Stream_Builder, dom_module_through_fallback)
+{
+    rapidjson::StringStream is(R"json({
+        "unknown": { "deep": [1, 2, { "deeper": "skipped" }] },
+        "numeric": { "tolerance": 0.5 },
+        "various_data": { "type": "int", "value": 7 }
+    })json");
+
+    auto expected = Build_From_JSON_Stream<Numeric, Various_Data>(is);
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.5);
+    const auto& vd = expected.Value().Get<Various_Data>().type;
+    ASSERT_TRUE(std::holds_alternative<Int>(vd));
+    ASSERT_EQ(std::get<Int>(vd).value, 7);
+}
+
+TEST(Stream_Builder, sax_module_error)
+{
+    rapidjson::StringStream is(R"json({ "range": { "min": 5, "max": 1 } })json");
+
+    auto expected = Build_From_JSON_Stream<Range>(is);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().module_name, std::string_view("range"));
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Range_Error::MIN_GREATER_THAN_MAX));
+}
+
+TEST(Stream_Builder, sax_hook_error)
+{
+    rapidjson::StringStream is(R"json({ "range": { "min": 1.5, "max": 3 } })json");
+
+    auto expected = Build_From_JSON_Stream<Range>(is);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().module_name, std::string_view("range"));
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Range_Error::SHOULD_BE_AN_INT));
+}
+
+TEST(Stream_Builder, sax_module_through_document)
+{
+    auto expected = Build_From_JSON_String<Range>(R"json({ "range": { "min": 1 } })json");
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(Range_Error::MISSING_BOUND));
+
+    auto valid = Build_From_JSON_String<Range>(R"json({ "range": { "min": 1, "max": 3 } })json");
+    ASSERT_TRUE(valid.Has_Value());
+    ASSERT_EQ(valid.Value().Get<Range>().max, 3);
+}
+
+TEST(Stream_Builder, root_is_not_an_object)
+{
+    rapidjson::StringStream is(R"json([ { "range": { "min": 1, "max": 3 } } ])json");
+
+    auto expected = Build_From_JSON_Stream<Range>(is);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(JSON_ROOT_IS_NOT_AN_OBJECT));
+}
+
+TEST(Stream_Builder, parse_error_on_malformed_json)
+{
+    rapidjson::StringStream is(R"json({ "numeric": { "tolerance": 1.23 )json");
+
+    auto expected = Build_From_JSON_Stream<Numeric>(is);
+    ASSERT_FALSE(expected.Has_Value());
+    ASSERT_EQ(expected.Error().error_id, static_cast<int>(JSON_PARSING_FAILED));
+}
+
+TEST(Stream_Builder, from_file)
+{
+    const std::filesystem::path p = "temp_stream_builder.json";
+    {
+        std::ofstream ofs(p, std::ios::binary);
+        ofs << R"json({ "numeric": { "tolerance": 0.125 }, "range": { "min": 0, "max": 9 } })json";
+    }
+
+    FILE* fp = std::fopen(p.generic_string().c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    char buffer[256];
+    rapidjson::FileReadStream is(fp, buffer, sizeof(buffer));
+    auto expected = Build_From_JSON_Stream<Numeric, Range>(is);
+    std::fclose(fp);
+
+    ASSERT_TRUE(expected.Has_Value());
+    ASSERT_DOUBLE_EQ(expected.Value().Get<Numeric>().tolerance, 0.125);
+    ASSERT_EQ(expected.Value().Get<Range>().max, 9);
+
+    std::error_code ec;
+    std::filesystem::remove(p, ec);
+}
@@ -7,6 +7,12 @@ struct Numeric
     double tolerance = 1e-6;
 };
 
+// Numeric loaded and written through field descriptors
+struct Fields_Numeric
+{
+    double tolerance = 1e-6;
+};
+
 struct Null
 {
 
@@ -27,4 +33,10 @@ struct Various_Data
     std::variant<Int, Double, Null> type;
 };
 
+struct Range
+{
+    int min = 0;
+    int max = 0;
+};
+
 #endif //SRC_CONFIGURATION_TEST_TEST_STRUCTURE_H
\ No newline at end of file
@@ -0,0 +1,101 @@
+#ifndef SRC_CONFIGURATION_TEST_TEST_STRUCTURE_BINARY_H
+#define SRC_CONFIGURATION_TEST_TEST_STRUCTURE_BINARY_H
+
+#include <cstdint>
+#include <variant>
+
+#include "include/configuration/module/binary_serializer.h"
+#include "test_structure.h"
+
+// =======================================================
+//  Numeric_Binary
+// =======================================================
+struct Numeric_Binary : O::Configuration::Module::Binary_Serializer<Numeric_Binary, Numeric>
+{
+	void Save(O::Configuration::Module::Binary_Output& output, const Numeric& data) const
+	{
+		output.Write(data.tolerance);
+	}
+
+	bool Load(O::Configuration::Module::Binary_Input& input, Numeric& data) const
+	{
+		return input.Read(data.tolerance);
+	}
+
+	static constexpr const char* Key() noexcept { return "numeric"; }
+	static constexpr std::uint32_t Version() noexcept { return 1; }
+};
+
+
+// =======================================================
+//  Various_Data_Binary
+// =======================================================
+struct Various_Data_Binary : O::Configuration::Module::Binary_Serializer<Various_Data_Binary, Various_Data>
+{
+	void Save(O::Configuration::Module::Binary_Output& output, const Various_Data& data) const
+	{
+		output.Write(static_cast<std::uint8_t>(data.type.index()));
+		if (const Int* i = std::get_if<Int>(&data.type))
+			output.Write(i->value);
+		else if (const Double* d = std::get_if<Double>(&data.type))
+			output.Write(d->value);
+	}
+
+	bool Load(O::Configuration::Module::Binary_Input& input, Various_Data& data) const
+	{
+		std::uint8_t index = 0;
+		if (!input.Read(index))
+			return false;
+
+		switch (index)
+		{
+		case 0:
+		{
+			Int i;
+			if (!input.Read(i.value))
+				return false;
+			data.type = i;
+			return true;
+		}
+		case 1:
+		{
+			Double d;
+			if (!input.Read(d.value))
+				return false;
+			data.type = d;
+			return true;
+		}
+		case 2:
+			data.type = Null{};
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	static constexpr const char* Key() noexcept { return "various_data"; }
+	static constexpr std::uint32_t Version() noexcept { return 1; }
+};
+
+
+// =======================================================
+//  Range_Binary
+// =======================================================
+struct Range_Binary : O::Configuration::Module::Binary_Serializer<Range_Binary, Range>
+{
+	void Save(O::Configuration::Module::Binary_Output& output, const Range& data) const
+	{
+		output.Write(data.min);
+		output.Write(data.max);
+	}
+
+	bool Load(O::Configuration::Module::Binary_Input& input, Range& data) const
+	{
+		return input.Read(data.min) && input.Read(data.max) && data.min <= data.max;
+	}
+
+	static constexpr const char* Key() noexcept { return "range"; }
+	static constexpr std::uint32_t Version() noexcept { return 1; }
+};
+
+#endif // SRC_CONFIGURATION_TEST_TEST_STRUCTURE_BINARY_H
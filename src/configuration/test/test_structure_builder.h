@@ -2,6 +2,8 @@
 #define SRC_CONFIGURATION_TEST_TEST_STRUCTURE_BUILDER_H
 
 #include "include/configuration/module/json_builder.h"
+#include "include/configuration/module/json_fields.h"
+#include "include/configuration/module/json_sax_builder.h"
 
 #include "test_structure.h"
 
@@ -32,6 +34,33 @@ struct Numeric_Builder : public O::Configuration::Module::JSON_Builder<Numeric_B
 	}
 };
 
+// same module described by fields, for the JSON_Fields_Builder/JSON_Fields_Writer tests
+struct Numeric_Fields
+{
+	using Data = Fields_Numeric;
+	using Error = Numeric_Error;
+
+	static constexpr const char* Key() noexcept
+	{
+		return "numeric";
+	}
+
+	static constexpr Numeric_Error Not_An_Object_Error() noexcept
+	{
+		return Numeric_Error::SHOULD_BE_AND_OBJECT;
+	}
+
+	static constexpr auto Fields() noexcept
+	{
+		return std::tuple{
+			O::Configuration::Module::Field{ "tolerance", &Fields_Numeric::tolerance, Numeric_Error::SHOULD_BE_A_DOUBLE,
+				[](double tolerance) { return tolerance < 0 ? std::optional(Numeric_Error::NOT_POSITIVE) : std::nullopt; } }
+		};
+	}
+};
+
+using Numeric_Fields_Builder = O::Configuration::Module::JSON_Fields_Builder<Numeric_Fields>;
+
 enum class Various_Error
 {
 	SHOULD_BE_AND_OBJECT,
@@ -82,5 +111,77 @@ struct Various_Data_Builder : public O::Configuration::Module::JSON_Builder<Vari
     }
 };
 
+enum class Range_Error
+{
+	SHOULD_BE_AN_OBJECT,
+	SHOULD_BE_AN_INT,
+	MISSING_BOUND,
+	MIN_GREATER_THAN_MAX
+};
+
+struct Range_Builder : public O::Configuration::Module::JSON_SAX_Builder<Range_Builder, Range, Range_Error>
+{
+	bool On_Start_Object()
+	{
+		if (Depth() != 1)
+			return Fail(Range_Error::SHOULD_BE_AN_INT);
+		return true;
+	}
+
+	bool On_Key(std::string_view key)
+	{
+		current = key == "min" ? Bound::MIN : key == "max" ? Bound::MAX : Bound::NONE;
+		return true;
+	}
+
+	bool On_Int(std::int64_t value)
+	{
+		if (Depth() != 1)
+			return Fail(Range_Error::SHOULD_BE_AN_OBJECT);
+		if (current == Bound::MIN)
+		{
+			data.min = static_cast<int>(value);
+			has_min = true;
+		}
+		else if (current == Bound::MAX)
+		{
+			data.max = static_cast<int>(value);
+			has_max = true;
+		}
+		return true;
+	}
+
+	bool On_Double(double)
+	{
+		return Fail(Depth() == 1 ? Range_Error::SHOULD_BE_AN_INT : Range_Error::SHOULD_BE_AN_OBJECT);
+	}
+
+	std::optional<Range_Error> Finish_SAX()
+	{
+		if (!has_min || !has_max)
+			return Range_Error::MISSING_BOUND;
+		if (data.min > data.max)
+			return Range_Error::MIN_GREATER_THAN_MAX;
+		return std::nullopt;
+	}
+
+	static constexpr Range_Error Unexpected_Error() noexcept
+	{
+		return Range_Error::SHOULD_BE_AN_OBJECT;
+	}
+
+	static constexpr const char* Key() noexcept
+	{
+		return "range";
+	}
+
+private:
+	enum class Bound { NONE, MIN, MAX };
+
+	Bound current = Bound::NONE;
+	bool has_min = false;
+	bool has_max = false;
+};
+
 
 #endif //SRC_CONFIGURATION_TEST_TEST_STRUCTURE_BUILDER_H
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "test_structure.h"
 #include "test_structure_builder.h"
 #include "test_structure_Writer.h"
+#include "test_structure_binary.h"
 #include "include/configuration/module/traits.h"
 
 
@@ -12,6 +13,7 @@ struct O::Configuration::Module::Traits<Various_Data>
 {
     using Builder = Various_Data_Builder;
     using Writer = Various_Data_Writer;
+    using Binary = Various_Data_Binary;
 };
 
 template<>
@@ -19,6 +21,22 @@ struct O::Configuration::Module::Traits<Numeric>
 {
     using Builder = Numeric_Builder;
      using Writer = Numeric_Writer;
+    using Binary = Numeric_Binary;
+};
+
+template<>
+struct O::Configuration::Module::Traits<Fields_Numeric>
+{
+    using Builder = Numeric_Fields_Builder;
+    using Writer = Numeric_Fields_Writer;
+};
+
+template<>
+struct O::Configuration::Module::Traits<Range>
+{
+    using Builder = Range_Builder;
+    using Writer = Range_Writer;
+    using Binary = Range_Binary;
 };
 
 #endif //SRC_CONFIGURATION_TEST_TEST_STRUCTURE_TRAIT_H
\ No newline at end of file
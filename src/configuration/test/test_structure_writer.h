@@ -5,8 +5,10 @@
 #include <variant>
 #include <rapidjson/writer.h>
 
+#include "include/configuration/module/json_fields.h"
 #include "include/configuration/module/json_writer.h"
 #include "test_structure.h"
+#include "test_structure_builder.h"
 
 // =======================================================
 //  Numeric_Writer
@@ -27,6 +29,8 @@ struct Numeric_Writer : O::Configuration::Module::JSON_Writer<Numeric_Writer, Nu
 	static constexpr const char* Key() noexcept { return "numeric"; }
 };
 
+using Numeric_Fields_Writer = O::Configuration::Module::JSON_Fields_Writer<Numeric_Fields>;
+
 
 // =======================================================
 //  Various_Data_Writer
@@ -72,4 +76,26 @@ struct Various_Data_Writer : O::Configuration::Module::JSON_Writer<Various_Data_
 	static constexpr const char* Key() noexcept { return "various_data"; }
 };
 
+
+// =======================================================
+//  Range_Writer
+// =======================================================
+struct Range_Writer : O::Configuration::Module::JSON_Writer<Range_Writer, Range>
+{
+	template<class W>
+	void To_JSON(W& w, const Range& data) const
+	{
+		w.StartObject();
+
+		w.Key("min");
+		w.Int(data.min);
+		w.Key("max");
+		w.Int(data.max);
+
+		w.EndObject();
+	}
+
+	static constexpr const char* Key() noexcept { return "range"; }
+};
+
 #endif // SRC_CONFIGURATION_TEST_TEST_STRUCTURE_WRITER_H
@@ -0,0 +1,141 @@
+// validator_test.cpp
+
+#include "test_structure.h"
+#include "test_structure_builder.h"
+#include "test_structure_trait.h"
+
+#include "configuration/application/json_builder.h"
+#include "configuration/application/json_validator.h"
+#include "configuration/application/parse_context.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace O::Configuration::Application;
+
+namespace
+{
+    struct Probe
+    {
+        int value = 0;
+    };
+
+    enum class Probe_Error
+    {
+        SHOULD_BE_AN_INT
+    };
+
+    int probe_loads = 0;
+    int probe_validations = 0;
+
+    struct Probe_Builder : O::Configuration::Module::JSON_Builder<Probe_Builder, Probe, Probe_Error>
+    {
+        std::optional<Probe_Error> Load_From_JSON(const rapidjson::Value& v)
+        {
+            ++probe_loads;
+            if (!v.IsInt())
+                return Probe_Error::SHOULD_BE_AN_INT;
+            data.value = v.GetInt();
+            return std::nullopt;
+        }
+
+        std::optional<Probe_Error> Validate_JSON(const rapidjson::Value& v)
+        {
+            ++probe_validations;
+            if (!v.IsInt())
+                return Probe_Error::SHOULD_BE_AN_INT;
+            return std::nullopt;
+        }
+
+        static constexpr const char* Key() noexcept { return "probe"; }
+    };
+}
+
+template<>
+struct O::Configuration::Module::Traits<Probe>
+{
+    using Builder = Probe_Builder;
+};
+
+TEST(Validator, same_result_as_build)
+{
+    const std::vector<std::string> inputs = {
+        R"json({ "numeric": { "tolerance": 0.5 }, "various_data": { "type": "int", "value": 3 }, "range": { "min": 1, "max": 2 } })json",
+        R"json({ "numeric": { "tolerance": -1 }, "range": { "min": 3, "max": 2 } })json",
+        R"json({ "numeric": { "tolerance": "a" } })json",
+        R"json({ "numeric": 4 })json",
+        R"json({ "numeric": {} })json",
+        R"json({ "various_data": { "type": "text" }, "range": { "min": 3, "max": 2 } })json",
+        R"json({ "range": { "min": 3, "max": 2 } })json",
+        R"json({ "range": { "min": 1 } })json",
+        R"json({ "unknown": [ 1, 2 ] })json",
+        R"json([ 1, 2 ])json",
+        R"json({ "numeric": )json",
+    };
+
+    Parse_Context context;
+    for (const std::string& json : inputs)
+    {
+        auto built = Build_From_JSON_String<Numeric, Various_Data, Range>(json);
+        std::optional<Error> validated = Validate_JSON_String<Numeric, Various_Data, Range>(json);
+        std::optional<Error> with_context = Validate_JSON_String<Numeric, Various_Data, Range>(json, context);
+
+        ASSERT_EQ(built.Has_Value(), !validated.has_value()) << json;
+        ASSERT_EQ(validated.has_value(), with_context.has_value()) << json;
+        if (validated)
+        {
+            ASSERT_EQ(built.Error().module_name, validated->module_name) << json;
+            ASSERT_EQ(built.Error().error_id, validated->error_id) << json;
+            ASSERT_EQ(with_context->module_name, validated->module_name) << json;
+            ASSERT_EQ(with_context->error_id, validated->error_id) << json;
+        }
+    }
+}
+
+TEST(Validator, uses_the_validate_hook)
+{
+    probe_loads = 0;
+    probe_validations = 0;
+
+    ASSERT_FALSE(Validate_JSON_String<Probe>(R"json({ "probe": 3 })json").has_value());
+
+    std::optional<Error> error = Validate_JSON_String<Probe>(R"json({ "probe": "3" })json");
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error->module_name, "probe");
+    ASSERT_EQ(error->error_id, static_cast<int>(Probe_Error::SHOULD_BE_AN_INT));
+
+    ASSERT_EQ(probe_validations, 2);
+    ASSERT_EQ(probe_loads, 0);
+}
+
+TEST(Validator, files_with_one_context)
+{
+    const std::filesystem::path valid = "tmp_validator_valid.json";
+    const std::filesystem::path invalid = "tmp_validator_invalid.json";
+    {
+        std::ofstream(valid, std::ios::binary) << R"json({ "numeric": { "tolerance": 1.5 } })json";
+        std::ofstream(invalid, std::ios::binary) << R"json({ "numeric": { "tolerance": -1.5 } })json";
+    }
+
+    Parse_Context context;
+    for (Read_Mode mode : { Read_Mode::STREAM, Read_Mode::MEMORY_MAPPED })
+    {
+        ASSERT_FALSE(Validate_JSON_File<Numeric>(valid, context, mode).has_value());
+        ASSERT_FALSE(Validate_JSON_File<Numeric>(valid, mode).has_value());
+
+        std::optional<Error> error = Validate_JSON_File<Numeric>(invalid, context, mode);
+        ASSERT_TRUE(error.has_value());
+        ASSERT_EQ(error->error_id, static_cast<int>(Numeric_Error::NOT_POSITIVE));
+
+        std::optional<Error> missing = Validate_JSON_File<Numeric>("tmp_validator_missing.json", context, mode);
+        ASSERT_TRUE(missing.has_value());
+        ASSERT_EQ(missing->error_id, static_cast<int>(FILE_OPENING_FAILED));
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(valid, ec);
+    std::filesystem::remove(invalid, ec);
+}
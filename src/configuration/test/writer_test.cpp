@@ -11,6 +11,8 @@
 #include <fstream>
 #include <filesystem>
 #include <string>
+#include <span>
+#include <vector>
 
 using namespace O::Configuration::Application;
 
@@ -174,3 +176,158 @@ TEST(Writer, Roundtrip_String_ReadBack_Various)
 	ASSERT_TRUE(std::holds_alternative<Double>(rd.type));
 	ASSERT_DOUBLE_EQ(std::get<Double>(rd.type).value, 9.81);
 }
+
+TEST(Writer, Caller_String_Reuses_Capacity)
+{
+	Container<Numeric, Various_Data, Range> c;
+	c.Get<Numeric>().tolerance = 0.5;
+	c.Get<Various_Data>().type = Int{ 3 };
+	c.Get<Range>() = Range{ 1, 2 };
+
+	const std::string expected = Write_As_JSON_String(c);
+	ASSERT_EQ(Measure_JSON_Size(c), expected.size());
+
+	std::string out = "previous content";
+	out.reserve(Measure_JSON_Size(c));
+	const char* data = out.data();
+	Write_As_JSON_String(c, out);
+	ASSERT_EQ(out, expected);
+	Write_As_JSON_String(c, out);
+	ASSERT_EQ(out, expected);
+	ASSERT_EQ(out.data(), data);
+
+	std::vector<char> chars = { 'x' };
+	Write_As_JSON_String(c, chars);
+	ASSERT_EQ(std::string(chars.begin(), chars.end()), expected);
+}
+
+TEST(Writer, Span_Output)
+{
+	Container<Numeric, Range> c;
+	c.Get<Range>() = Range{ -4, 4 };
+	const std::string expected = Write_As_JSON_String(c);
+
+	std::vector<char> buffer(expected.size());
+	auto exact = Write_As_JSON_String(c, std::span<char>(buffer));
+	ASSERT_TRUE(exact.Has_Value());
+	ASSERT_EQ(exact.Value(), expected.size());
+	ASSERT_EQ(std::string(buffer.begin(), buffer.end()), expected);
+
+	auto too_small = Write_As_JSON_String(c, std::span<char>(buffer).first(expected.size() - 1));
+	ASSERT_FALSE(too_small.Has_Value());
+	ASSERT_EQ(too_small.Error(), Write_Error::BUFFER_TOO_SMALL);
+}
+
+TEST(Writer, Atomic_File)
+{
+	Container<Numeric, Range> c;
+	c.Get<Numeric>().tolerance = 0.75;
+	c.Get<Range>() = Range{ 0, 10 };
+	const std::string expected = Write_As_JSON_String(c);
+
+	const std::filesystem::path tmpfile = "tmp_atomic_writer_test.json";
+	std::error_code ec;
+	std::filesystem::remove(tmpfile, ec);
+	{
+		std::ofstream previous(tmpfile, std::ios::binary);
+		previous << "previous content";
+	}
+
+	File_Write_Options options;
+	options.atomic = true;
+	auto err = Write_As_JSON_File(c, tmpfile, options);
+	ASSERT_FALSE(err.has_value());
+
+	std::ifstream ifs(tmpfile, std::ios::binary);
+	std::string contents{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+	ifs.close();
+	ASSERT_EQ(contents, expected);
+
+	// no temporary file left next to the destination
+	for (const auto& entry : std::filesystem::directory_iterator("."))
+		ASSERT_EQ(entry.path().filename().string().find("tmp_atomic_writer_test.json."), std::string::npos);
+
+	auto missing = Write_As_JSON_File(c, "nonexistent_dir/output.json", options);
+	ASSERT_TRUE(missing.has_value());
+	ASSERT_EQ(*missing, Write_Error::FILE_OPEN_FAILED);
+
+	std::filesystem::remove(tmpfile, ec);
+}
+
+TEST(Writer, Stream_Coalesces_Writes)
+{
+	struct Recording_Sink
+	{
+		std::vector<std::size_t> calls;
+		std::string content;
+
+		std::optional<Write_Error> Write(const char* data, std::size_t size)
+		{
+			calls.push_back(size);
+			content.append(data, size);
+			return std::nullopt;
+		}
+	};
+
+	Container<Numeric, Various_Data, Range> c;
+	c.Get<Various_Data>().type = Double{ 1.5 };
+	const std::string expected = Write_As_JSON_String(c);
+
+	Recording_Sink whole;
+	ASSERT_FALSE(Write_As_JSON_Stream(c, whole).has_value());
+	ASSERT_EQ(whole.calls.size(), 1u);
+	ASSERT_EQ(whole.content, expected);
+
+	Recording_Sink chunked;
+	ASSERT_FALSE(Write_As_JSON_Stream(c, chunked, 16).has_value());
+	ASSERT_EQ(chunked.calls.size(), (expected.size() + 15) / 16);
+	for (std::size_t size : chunked.calls)
+		ASSERT_LE(size, 16u);
+	ASSERT_EQ(chunked.content, expected);
+}
+
+TEST(Writer, Ring_Buffer_Sink)
+{
+	Container<Numeric, Range> c;
+	c.Get<Range>() = Range{ 3, 5 };
+	const std::string expected = Write_As_JSON_String(c);
+
+	Ring_Buffer ring(expected.size());
+	ASSERT_GE(ring.Capacity(), expected.size());
+
+	// move the head so the document wraps around the end of the storage
+	std::vector<char> out(ring.Capacity());
+	ASSERT_TRUE(ring.Write("0123456", 7));
+	ASSERT_EQ(ring.Read(out), 7u);
+
+	Ring_Buffer_Sink sink(ring);
+	ASSERT_FALSE(Write_As_JSON_Stream(c, sink, 8).has_value());
+	ASSERT_EQ(ring.Size(), expected.size());
+	const std::size_t read = ring.Read(out);
+	ASSERT_EQ(std::string(out.data(), read), expected);
+	ASSERT_EQ(ring.Size(), 0u);
+
+	Ring_Buffer small(expected.size() / 4);
+	Ring_Buffer_Sink small_sink(small);
+	auto err = Write_As_JSON_Stream(c, small_sink, 8);
+	ASSERT_TRUE(err.has_value());
+	ASSERT_EQ(*err, Write_Error::BUFFER_TOO_SMALL);
+}
+
+TEST(Writer, File_Sink)
+{
+	Container<Numeric> c;
+	c.Get<Numeric>().tolerance = 4.0;
+	const std::string expected = Write_As_JSON_String(c);
+
+	std::FILE* file = std::tmpfile();
+	ASSERT_NE(file, nullptr);
+	File_Sink sink(file);
+	ASSERT_FALSE(Write_As_JSON_Stream(c, sink).has_value());
+
+	std::rewind(file);
+	std::string contents(expected.size() + 1, '\0');
+	contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+	std::fclose(file);
+	ASSERT_EQ(contents, expected);
+}